@@ -8,22 +8,69 @@
 #include <vector>
 #include <stack>
 #include <map>
-#include <unordered_set>
 
 #include <memory>
 #include <chrono>
+#include <thread>
 
 #include <cassert>
 
 #include "Basic.hpp"
 #include "SearcComponent/Reference.hpp"
+#include "SearcComponent/VisitedSet.hpp"
 #include "SearcComponent/BeamSearchProcess.hpp"
+#include "SearcComponent/ParallelBeamSearchProcess.hpp"
+#include "SearcComponent/EulerTourBeamSearchProcess.hpp"
+#include "SearcComponent/WorkerPool.hpp"
 
 namespace alib::Search {
 	using DebugProcess = Lib::BeamSearchProcess<Lib::DebugConfig, int>;
 
+	namespace Lib {
+		/**
+		 * @brief TԂinitEsearchz֐oRɌĂяo邩
+		 * @details TԂfinalŌJꂽinitEsearchꍇAIȌ^m肷邽ߌĂяoWJł
+		 * @tparam Space T
+		 * @tparam Base TԂ̊NX
+		 * @tparam Method T
+		*/
+		template<class Space, class Base, class Method, class = void>
+		struct IsStaticDispatchable : std::false_type {};
+
+		template<class Space, class Base, class Method>
+		struct IsStaticDispatchable<Space, Base, Method, std::void_t<
+			decltype(std::declval<Space&>().init(std::declval<const Method&>())),
+			decltype(std::declval<Space&>().search(std::declval<const Method&>()))>>
+			: std::bool_constant<std::is_final_v<Space>&& std::is_base_of_v<Base, Space>> {};
+
+		/**
+		 * @brief TWJm[hIԎɃnbV̏d
+		 * @details ꍇ͒TɒTς݃nbVnAT[vł͏d𔻒肵Ȃ
+		 * @tparam Process T
+		*/
+		template<class Process, class = void>
+		struct HasLayerFilter : std::false_type {};
+
+		template<class Process>
+		struct HasLayerFilter<Process, std::void_t<decltype(Process::UseLayerFilter())>>
+			: std::bool_constant<Process::UseLayerFilter()> {};
+
+		/**
+		 * @brief Tς݃nbV̏e
+		 * @details nbVȂꍇ͎gȂߊmۂȂ
+		*/
+		template<class Config>
+		NODISCARD constexpr size_type GetVisitedCapacity() noexcept {
+			return Config::HasHash() ? Config::GetVisitedCapacity() : 0;
+		}
+	}
+
+	template<class ProcessType>
+	class ParallelSearchTemplate;
+
 	/**
 	 * @brief SearchTemplate
+	 * @note TԁiSpacejfinalɂinitEsearch̉zĂяoȂ
 	 * @tparam Config
 	*/
 	template<class ProcessType>
@@ -32,6 +79,7 @@ namespace alib::Search {
 		using Process = ProcessType;
 		using Config = typename Process::Config;
 		using SearchMethod = typename Config::SearchMethod;
+		using Space = typename Process::SpaceType;
 
 		SearchTemplate() = default;
 		virtual ~SearchTemplate() = default;
@@ -41,29 +89,72 @@ namespace alib::Search {
 		SearchTemplate(const SearchTemplate&) = delete;
 		SearchTemplate& operator=(const SearchTemplate&) = delete;
 	private:
+		// T͊e[J[œT[vg
+		template<class>
+		friend class ParallelSearchTemplate;
+
 		// Tς݃nbV
-		std::unordered_set<size_t> visited{};
+		Lib::VisitedSet visited{ Lib::GetVisitedCapacity<Config>() };
 		Process process{};
 
-		void loop() {
-			if (process.onloop()) {
+		NODISCARD static constexpr bool IsStaticDispatch() noexcept {
+			return Lib::IsStaticDispatchable<Space, SearchTemplate, SearchMethod>::value;
+		}
+		void dispatchInit(const SearchMethod& argument) {
+			if constexpr (IsStaticDispatch()) {
+				static_cast<Space&>(*this).init(argument);
+			}
+			else {
+				init(argument);
+			}
+		}
+		void dispatchSearch(const SearchMethod& argument) {
+			if constexpr (IsStaticDispatch()) {
+				static_cast<Space&>(*this).search(argument);
+			}
+			else {
+				search(argument);
+			}
+		}
+
+		/** @brief T[vŃnbV̏d𔻒肷 */
+		NODISCARD static constexpr bool UseLoopFilter() noexcept {
+			return Config::HasHash() && not Lib::HasLayerFilter<Process>::value;
+		}
+
+		/**
+		 * @brief Tς݃nbVɂAT̃^C}[Jn
+		*/
+		void prepare() {
+			visited.clear();
+			if constexpr (Lib::HasLayerFilter<Process>::value) {
+				process.setLayerFilter(visited);
+			}
+			process.timerStart();
+		}
+
+		/**
+		 * @brief T[v
+		 * @param first ŏɏm[h init Ăяo
+		*/
+		void loop(const bool first = true) {
+			if (first && process.onloop()) {
 				const auto& argument = process.getArgument();
-				if constexpr (Config::HasHash()) {
+				if constexpr (UseLoopFilter()) {
 					visited.insert(argument.hash);
 				}
 				process.accept();
-				init(argument);
+				dispatchInit(argument);
 			}
 			while (process.onloop()) {
 				const auto& argument = process.getArgument();
-				if constexpr (Config::HasHash()) {
-					if (visited.find(argument.hash) != visited.end()) {
+				if constexpr (UseLoopFilter()) {
+					if (not visited.insert(argument.hash)) {
 						continue;
 					}
-					visited.insert(argument.hash);
 				}
 				process.accept();
-				search(argument);
+				dispatchSearch(argument);
 			}
 		}
 	protected:
@@ -90,10 +181,22 @@ namespace alib::Search {
 		NODISCARD int getDepth() const noexcept {
 			return process.getDepth();
 		}
+
+		/**
+		 * @brief T̏Ԃo^
+		 * @details ԑŜ̕iConfig::UseStateCopy()jƃ`FbN|CgŁAo^ԂoCgƂĕ
+		 * @param state L^lSĊ܂݁AÕQƂȂ
+		 * @note ǂgȂꍇ͖邽߁ATԂ͐ݒɂ炸o^Ă悢
+		*/
+		template<class State>
+		void setSearchState(State& state) {
+			process.setStateRegion(std::addressof(state), sizeof(State));
+		}
 	public:
 		void start(const SearchMethod& argument) {
-			visited.clear();
-			process.timerStart();
+			// TOŔꍇoCh߂
+			const auto binding = process.bindMemo();
+			prepare();
 			process.init();
 			process.reserve(argument);
 			loop();
@@ -103,6 +206,63 @@ namespace alib::Search {
 			return process.getResultList();
 		}
 
+		/**
+		 * @brief ԑJڂœKppb`
+		 * @return pb`
+		*/
+		NODISCARD auto getTransitionCounter() const {
+			return process.getTransitionCounter();
+		}
+
+		/**
+		 * @brief T̓v
+		 * @note Config::GetDebug() ̏ꍇ̂݋L^
+		*/
+		NODISCARD const auto& getStats() const noexcept {
+			return process.getStats();
+		}
+
+		/**
+		 * @brief T̍ŗǂ̌
+		 * @note ʃXbhĂяo
+		*/
+		NODISCARD auto getBestResult() const {
+			return process.getBestResult();
+		}
+		/**
+		 * @brief [xƂ̒T󋵂̒ʒmݒ肷
+		 * @param callback ʒmifalseԂƒTIj
+		*/
+		template<class Callback>
+		void setProgressCallback(Callback&& callback) {
+			process.setProgressCallback(std::forward<Callback>(callback));
+		}
+		/**
+		 * @brief T̏Iv
+		 * @note ʃXbhĂяo
+		*/
+		void requestStop() noexcept {
+			process.requestStop();
+		}
+
+		/**
+		 * @brief Tp[^ݒ肷
+		 * @param parameters ̒TgT[xEr[ET
+		 * @note Config::UseRuntimeParameters() ̏ꍇ̂ݎg
+		*/
+		void setParameters(const SearchParameters& parameters) {
+			process.setParameters(parameters);
+			if constexpr (Config::HasHash()) {
+				visited.reserve(parameters.depth * parameters.width);
+			}
+		}
+		/**
+		 * @brief Tp[^
+		*/
+		NODISCARD auto getParameters() const noexcept {
+			return process.getParameters();
+		}
+
 		/**
 		 * @brief ̃p^[𐶐
 		 * @param 
@@ -117,4 +277,94 @@ namespace alib::Search {
 
 	template<class Config, class Space>
 	using BeamSearchTemplate = SearchTemplate<Lib::BeamSearchProcess<Config, Space>>;
+
+	/**
+	 * @brief IC[cA[̃r[T[`
+	 * @details [TɁAcT؂pb`̗ƂĐ[xƂɑ
+	*/
+	template<class Config, class Space>
+	using EulerTourBeamSearchTemplate = SearchTemplate<Lib::EulerTourBeamSearchProcess<Config, Space>>;
+
+	/**
+	 * @brief ParallelSearchTemplate
+	 * @details TԂ𕡐Đ[xƂ̒Tm[h𕡐Xbhŏie[J[̒T[v SearchTemplate Ƌʁj
+	 * @note TԂ̓Rs[\zERs[\ŁAMemoŋL^ϐSĎg̓Ɏ
+	 * @tparam ProcessType
+	*/
+	template<class ProcessType>
+	class ParallelSearchTemplate : public SearchTemplate<ProcessType> {
+	private:
+		using base = SearchTemplate<ProcessType>;
+	public:
+		using Process = ProcessType;
+		using Config = typename Process::Config;
+		using SearchMethod = typename Config::SearchMethod;
+		using Space = typename Process::SpaceType;
+
+		ParallelSearchTemplate() = default;
+	protected:
+		/** @brief [J[p̕iT͕Ȃj */
+		ParallelSearchTemplate(const ParallelSearchTemplate&) : base(), workers() {}
+		/** @brief [J[̒TԂ̍XViTƃ[J[͕ێj */
+		ParallelSearchTemplate& operator=(const ParallelSearchTemplate&) noexcept { return *this; }
+	private:
+		// 擪ȊÕ[J[iT܂ŕێj
+		std::vector<std::unique_ptr<Space>> workers{};
+
+		NODISCARD ParallelSearchTemplate& getWorker(const size_type index) noexcept {
+			if (index == 0) {
+				return *this;
+			}
+			return *workers[index - 1];
+		}
+
+		void work(const bool first) {
+			const auto binding = this->process.bindMemo();
+			this->loop(first);
+		}
+
+		void run(const std::vector<Process*>& processes) {
+			// [J[Xbh͒T̊ԈێA[xƂɏ̊JnƊ𓯊
+			bool first = true;
+			Lib::WorkerPool pool;
+			pool.start(processes.size() - 1, [this, &first](const size_type idx) { getWorker(idx + 1).work(first); });
+			while (this->process.distribute(processes)) {
+				pool.dispatch();
+				work(first);
+				pool.wait();
+				first = false;
+			}
+			pool.stop();
+			this->process.finish(processes);
+		}
+	public:
+		void start(const SearchMethod& argument) {
+			this->prepare();
+
+			// 2ڈȍ~̓[J[̒TԂMemoėpATԂ̏Ԃ̂ݎʂ
+			if (workers.empty()) {
+				forstep(idx, 1, Process::GetThreads()) {
+					workers.push_back(std::make_unique<Space>(static_cast<const Space&>(*this)));
+				}
+			}
+			else {
+				for (auto& worker : workers) {
+					*worker = static_cast<const Space&>(*this);
+				}
+			}
+
+			std::vector<Process*> processes;
+			std::vector<const Space*> spaces;
+			forange(idx, workers.size() + 1) {
+				processes.push_back(std::addressof(getWorker(idx).process));
+				spaces.push_back(static_cast<const Space*>(std::addressof(getWorker(idx))));
+			}
+			this->process.init(processes, spaces);
+			this->process.reserve(argument);
+			run(processes);
+		}
+	};
+
+	template<class Config, class Space>
+	using ParallelBeamSearchTemplate = ParallelSearchTemplate<Lib::ParallelBeamSearchProcess<Config, Space>>;
 }
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "BeamSearch.hpp"
+#include "SearcComponent/ChokudaiSearchProcess.hpp"
+
+namespace alib::Search {
+
+	template<class Config, class Space>
+	using ChokudaiSearchTemplate = SearchTemplate<Lib::ChokudaiSearchProcess<Config, Space>>;
+}
@@ -1,14 +1,36 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
 #include "SearchConfig.hpp"
 #include "SearchComponentLib.hpp"
 #include "SearchNode.hpp"
 #include "ExPriorityQueue.hpp"
+#include "VisitedSet.hpp"
+#include "SearchMonitor.hpp"
+#include "SearchStats.hpp"
+#include "Checkpoint.hpp"
 #include "Timer.hpp"
 
 namespace alib::Search::Lib {
 	using DebugConfig = ConfigTemplate<10, 100, 1000, DefaultSearchMethod<int, double, size_t>>;
 
+	/**
+	 * @brief ԑJڂœKppb`
+	*/
+	struct TransitionCounter {
+		/** @brief ߂pb` */
+		size_type undo = 0;
+		/** @brief Kpb` */
+		size_type redo = 0;
+		/** @brief `FbN|Cg畜 */
+		size_type restore = 0;
+	};
+
 	/**
 	 * @brief r[T[`
 	 * @tparam Config
@@ -17,42 +39,223 @@ namespace alib::Search::Lib {
 	class BeamSearchProcess {
 	public:
 		using Config = ConfigClass;
+		using SpaceType = Space;
 	private:
 		using ArgumentType = typename Config::ArgumentType;
 		using SearchMethod = typename Config::SearchMethod;
-		using Node = SearchNode<Config>;
-		using NodePointer = Node*;
-		using RankingItem = std::pair<typename Config::ScoreType, NodePointer>;
+		using NodePool = CompactNodePool<ArgumentType>;
+		/** @brief m[h̔ԍi0͖j */
+		using NodeIndex = typename NodePool::index_type;
+		using Candidate = SearchCandidate<Config, NodeIndex>;
+		/** @brief em[h̓WJT */
+		struct GroupedCandidate : public Candidate {
+			GroupedCandidate() = default;
+			GroupedCandidate(NodeIndex parent, const SearchMethod& arg, const size_type order) noexcept : Candidate(parent, arg), order(order) {}
+
+			/** @brief em[h̓WJ */
+			size_type order = 0;
+		};
+
+		using RankingItem = std::conditional_t<Config::UseGroupedExpansion(), GroupedCandidate, Candidate>;
 		using Ranking = ExPriorityQueue<RankingItem>;
+		/** @brief 擪ɎL[ */
+		using BoundedRanking = ExPriorityQueue<RankingItem, typename Ranking::greater>;
+		using NextRanking = std::conditional_t<Config::UseBoundedRanking(), BoundedRanking, Ranking>;
 		using IMemo = MemoSingleton<Space>;
 
+		/** @brief \񎞂ɏd */
+		static constexpr bool UseReserveDedupe = Config::HasHash() && Config::GetDedupeScope() != DedupeScope::Expand;
+
+		/**
+		 * @brief \ς݃nbV̋L^
+		*/
+		struct DedupeEntry {
+			/** @brief ̈ʒuipς݂̏ꍇ͖lj */
+			size_type index = 0;
+			/** @brief \񂵂[xicT[xj */
+			int depth = 0;
+		};
+		static constexpr size_type InvalidIndex = static_cast<size_type>(-1);
+
+		/** @brief oPbgƂ̓WJ𐧌 */
+		static constexpr bool UseBucketCap = 0 < Config::GetBucketCapacity();
+
+		/** @brief T[xEr[ETԂsɎw肷 */
+		static constexpr bool UseRuntime = Config::UseRuntimeParameters();
+		/** @brief ԑŜm[hƂɕiL^Ȃj */
+		static constexpr bool UseStateCopy = Config::UseStateCopy();
+		/** @brief Ԃ̕i`FbN|Cgjg */
+		static constexpr bool UseCheckpoint = not UseStateCopy && (0 < Config::GetCheckpointInterval() || 0 < Config::GetCheckpointBytes());
+
+		/** @brief ԑJڂœKppb`̈ꎞ̈isw̏ꍇ͒T[xɍ킹Ċmۂj */
+		using RedoBuffer = std::conditional_t<UseRuntime, std::vector<Memo::PatchType>, std::array<Memo::PatchType, Config::GetDepth()>>;
+
 		/** @brief ݂̒Tm[h */
-		NodePointer currentNode = nullptr;
-		/** @brief ̒Tm[h */
-		NodePointer nextNode = nullptr;
+		NodeIndex currentNode = 0;
+		/** @brief ̒T */
+		RankingItem nextCandidate{};
+		/** @brief ̒T₪ */
+		bool hasCandidate = false;
 
 		/** @brief ݂̒Tm[hL[ */
 		Ranking currentRanking;
 		/** @brief ̂̒Tm[hL[ */
-		Ranking nextRanking;
+		NextRanking nextRanking;
+		/** @brief ̒Tm[hL[̍ő̌␔iO̐[xET܂łɊϑlj */
+		size_type peakFrontier = 0;
 		int nodeWidthCount = 0;
 
+		/** @brief WJɕׂ݂̒Tm[h */
+		std::vector<RankingItem> currentLayer;
+		/** @brief ɓWJ錻݂̒Tm[h */
+		size_type layerCursor = 0;
+
+		/** @brief \񎞂̏dp̎̒Tisj */
+		std::vector<RankingItem> nextCandidates;
+		/** @brief \ς݃nbVƌ̈ʒu */
+		VisitedMap<DedupeEntry> reserved;
+		/** @brief ̒T̉iWidthɍîݗLj */
+		typename Config::ScoreType candidateFloor{};
+		bool hasCandidateFloor = false;
+
+		/** @brief WJm[hIԎɏdTς݃nbViUseLayerFilter() ̏ꍇ̂ݎgj */
+		VisitedSet* layerVisited = nullptr;
+
+		/** @brief ݂̐[x̃oPbgƂ̓WJ */
+		std::array<size_type, UseBucketCap ? Config::GetBucketCount() : 1> bucketCounts{};
+
+		/** @brief ݂̒Tm[hL[QƂem[h */
+		std::vector<NodeIndex> currentParents;
+		/** @brief ̒Tm[hL[QƂem[h */
+		std::vector<NodeIndex> nextParents;
+
+		/** @brief Tp[^isw̏ꍇ̂ݎgj */
+		SearchParameters parameters{ Config::GetDepth(), Config::GetWidth(), Config::GetLimit() };
+
 		/** @brief cT[x */
 		int remainDepth = narrow_cast<int>(Config::GetDepth());
 		/** @brief [x̒Tԁimsj */
 		double nextLimit = static_cast<double>(Config::GetLimit()) / Config::GetDepth();
+		/** @brief ݂̐[xœWJm[h */
+		size_type layerWidth = Config::GetWidth();
+		/** @brief \񒆂̌WJ[xœWJm[h */
+		size_type candidateWidth = Config::GetWidth();
+		/** @brief [xƂ̎Ԕz */
+		typename Config::TimeSchedule schedule;
 
 		/** @brief T^C}[ */
-		Timer timer;
+		DeadlineTimer timer{ Config::GetTimeTolerance() };
 		/** @brief m[hǗ */
-		SearchNodePool<Config> nodePool;
+		NodePool nodePool;
+		/** @brief TԂ̕ύX̋L^iT bindMemo ŌĂяoXbhɃoChj */
+		Memo memo;
+		/** @brief [x̐؂ւł܂Ƃ߂ĉpb`̃AhX */
+		std::vector<Memo::pointer> deadPatches;
+		/** @brief Ԃ̕iԑŜ̕ł͑Sm[h̏ԁj */
+		CheckpointStore checkpoints;
+
+		/** @brief ԑJڂœKppb` */
+		TransitionCounter transitionCounter;
+		/** @brief ԑJڂœKppb` */
+		RedoBuffer redos{};
+		/** @brief ԑJڂŖ߂pb`i`FbN|Cggꍇ̂݁AJڕ@߂܂Ŗ߂Ȃj */
+		std::conditional_t<UseCheckpoint, RedoBuffer, std::array<Memo::PatchType, 0>> undos{};
+
+		/** @brief T̓viConfig::GetDebug() ̏ꍇ̂݋L^j */
+		SearchStats<Config::GetDebug()> stats;
+
+		/** @brief ŗǂ̌iem[h̎QƂA̗͓ǂݏoɑgݗĂj */
+		Candidate best{};
+		/** @brief ŗǂ̌₪ŏI[x̌ */
+		bool bestComplete = false;
+		/** @brief T󋵂̒ʒm */
+		std::unique_ptr<SearchMonitor<Config>> monitor = std::make_unique<SearchMonitor<Config>>();
+
+		NODISCARD size_type searchDepth() const noexcept {
+			if constexpr (UseRuntime) {
+				return parameters.depth;
+			}
+			else {
+				return Config::GetDepth();
+			}
+		}
+		NODISCARD size_type searchLimit() const noexcept {
+			if constexpr (UseRuntime) {
+				return parameters.limit;
+			}
+			else {
+				return Config::GetLimit();
+			}
+		}
 
 		void destruction(const double t) {
+			stats.finish(t);
 			release(currentNode);
-			IMemo::Get().unlock();
+			reclaim();
+			if constexpr (not UseStateCopy) {
+				memo.unlock();
+			}
+			// ȍ~͕ʃXbhTm[hŗǂ̌ʂgݗĂ
+			monitor->finish();
 		}
-		NODISCARD double getNextLimit(const double interval) const noexcept {
-			return ((Config::GetLimit() - interval) / remainDepth) + interval;
+		/**
+		 * @brief ̐[x̒TvKp
+		 * @param interval oߎԁimsj
+		*/
+		void applyPlan(const double interval) noexcept {
+			// ɓWĴ͗\ς݂̌̐[x
+			const size_type maxWidth = Config::UseBoundedRanking() ? candidateWidth : static_cast<size_type>(-1);
+			const auto plan = schedule.next(interval, remainDepth, candidateWidth, maxWidth);
+			nextLimit = plan.deadline;
+			layerWidth = plan.width;
+		}
+
+		/**
+		 * @brief [xœWJm[h
+		 * @param depth WJ[xĩp^[̐-1j
+		*/
+		NODISCARD size_type widthAt(const int depth) const noexcept {
+			if constexpr (UseRuntime) {
+				return parameters.width;
+			}
+			else {
+				constexpr int last = static_cast<int>(Config::GetDepth()) - 1;
+				return Config::GetDepthWidth(static_cast<size_type>(depth < 0 ? 0 : (depth < last ? depth : last)));
+			}
+		}
+		/**
+		 * @brief S[xœWJm[h̍ő
+		*/
+		NODISCARD size_type maxDepthWidth() const noexcept {
+			if constexpr (UseRuntime) {
+				return parameters.width;
+			}
+			else {
+				size_type width = 0;
+				forange(depth, Config::GetDepth()) {
+					const size_type w = Config::GetDepthWidth(depth);
+					width = width < w ? w : width;
+				}
+				return width;
+			}
+		}
+		/**
+		 * @brief [xœWJm[h̍őɍ킹ăL[OɊmۂ
+		 * @details ̌܂L[͐[x̐؂ւōĊmۂȂBSĂ̎q󂯎鎟̒Tm[hL[́Aϑő̌␔Ŋmۂ
+		 * @note m[h̓v[ێčėp邽߁A2ڈȍ~̒Tł͊mۂȂ
+		*/
+		void reserveLayers() {
+			const size_type width = maxDepthWidth();
+			currentRanking.reserve(width);
+			nextRanking.reserve(Config::UseBoundedRanking() ? width + 1 : peakFrontier);
+			currentParents.reserve(width);
+			nextParents.reserve(width);
+			if constexpr (Config::UseGroupedExpansion()) {
+				currentLayer.reserve(width);
+			}
+			if constexpr (UseReserveDedupe && Config::UseBoundedRanking()) {
+				nextCandidates.reserve(width * 2);
+			}
 		}
 
 		/**
@@ -60,161 +263,696 @@ namespace alib::Search::Lib {
 		 * @param current Jڌ
 		 * @param next Jڐ
 		*/
-		void transitin(NodePointer current, NodePointer next) noexcept {
-			assert(next != nullptr);
-			assert(next->parent != nullptr);
-			assert(!next->patch.hasValue());
-
-			NodePointer currentRoot = current;
-			NodePointer nextRoot = next->parent;
-
-			std::array<Memo::PatchType, Config::GetDepth()> redos{};
-			int stack = narrow_cast<decltype(stack)>(Config::GetDepth());
-
-			while (currentRoot != nextRoot) {
-				assert(currentRoot != nullptr);
-				assert(nextRoot != nullptr);
-				if (currentRoot->depth < nextRoot->depth) {
-					if (nextRoot->patch.hasValue()) {
-						stack--;
-						WARN_PUSH_DISABLE(26446 26482);
-						redos[stack] = nextRoot->patch;
-						WARN_POP();
-					}
-					nextRoot = nextRoot->parent;
+		void transitin(const NodeIndex current, const NodeIndex next) noexcept {
+			assert(next != 0);
+			assert(nodePool.node(next).parent != 0);
+			assert(!nodePool.node(next).hasPatch());
+
+			if constexpr (UseStateCopy) {
+				// em[h̏Ԃ߂̂
+				checkpoints.restore(nodePool.node(next).parent);
+				transitionCounter.restore++;
+				return;
+			}
+			size_type undoCount = 0;
+			const auto path = CollectTransition(nodePool, current, nodePool.node(next).parent, redos, [&](const Memo::PatchType& patch) noexcept {
+				if constexpr (UseCheckpoint) {
+					// `FbN|CgJڂȂꍇ̂ݖ߂
+					WARN_PUSH_DISABLE(26446 26482);
+					undos[undoCount] = patch;
+					WARN_POP();
+				}
+				else {
+					patch.undo();
+				}
+				undoCount++;
+			});
+			if constexpr (UseCheckpoint) {
+				if (checkpoints.enabled() && transitFromCheckpoint(nodePool.node(next).parent, path.bytes)) {
+					// ߂\̃pb`͓KpȂ
+					return;
+				}
+				forange(idx, undoCount) {
+					WARN_PUSH_DISABLE(26446 26482);
+					undos[idx].undo();
+					WARN_POP();
+				}
+			}
+			transitionCounter.undo += undoCount;
+			stats.addUndo(undoCount);
+			const size_type redoCount = ApplyRedos(redos, path.first);
+			transitionCounter.redo += redoCount;
+			stats.addRedo(redoCount);
+		}
+
+		/**
+		 * @brief Jڐɋ߂`FbN|CgԑJڂ
+		 * @details ʏ̑JڂœKppb`̍vTCYAԂ̕ƃ`FbN|Cg̃pb`̍vTCY傫ꍇ̂ݑJڂ
+		 * @param target Jڐ
+		 * @param pathBytes ʏ̑JڂœKppb`̍vTCY
+		 * @return Jڂꍇtrue
+		*/
+		NODISCARD bool transitFromCheckpoint(const NodeIndex target, const size_type pathBytes) noexcept {
+			// Zm[hւ̑JڂȂǁAԂ̕菬Jڂ͒TȂ
+			size_type suffixBytes = checkpoints.size();
+			if (pathBytes <= suffixBytes) {
+				return false;
+			}
+			NodeIndex checkpoint = target;
+			while (not checkpoints.has(checkpoint)) {
+				suffixBytes += nodePool.node(checkpoint).patchSize;
+				checkpoint = nodePool.node(checkpoint).parent;
+				if (checkpoint == 0 || pathBytes <= suffixBytes) {
+					return false;
+				}
+			}
+
+			checkpoints.restore(checkpoint);
+			transitionCounter.restore++;
+
+			const size_type redoCount = ApplyRedos(redos, CollectRedos(nodePool, target, checkpoint, redos));
+			transitionCounter.redo += redoCount;
+			stats.addRedo(redoCount);
+			return true;
+		}
+
+		/**
+		 * @brief Tm[h̃`FbN|CgL^
+		 * @param index m[h̔ԍ
+		*/
+		void recordCheckpoint(const NodeIndex index) {
+			const auto& node = nodePool.node(index);
+			const NodeIndex parent = node.parent;
+			const size_type bytes = node.patchSize + (parent != 0 && not checkpoints.has(parent) ? checkpoints.getBytes(parent) : 0);
+
+			constexpr size_type interval = Config::GetCheckpointInterval();
+			constexpr size_type limit = Config::GetCheckpointBytes();
+			// ͏ɕۑA̋N_ɂ
+			if (parent == 0 || (0 < interval && static_cast<size_type>(node.depth) % interval == 0) || (0 < limit && limit <= bytes)) {
+				checkpoints.save(index);
+			}
+			else {
+				checkpoints.setBytes(index, bytes);
+			}
+		}
+
+		/**
+		 * @brief ܂ł̈
+		 * @param item 
+		 * @return iԂ̌̏ꍇ͋j
+		*/
+		NODISCARD std::vector<ArgumentType> makePath(const Candidate& item) const {
+			std::vector<ArgumentType> path;
+			// Ԃ̃m[h̐e͒TJnÕm[h
+			if (nodePool.node(item.parent).parent == 0) {
+				return path;
+			}
+			path.reserve(nodePool.node(item.parent).depth);
+			path.push_back(item.searchArgument.argument);
+			for (NodeIndex node = item.parent; nodePool.node(nodePool.node(node).parent).parent != 0; node = nodePool.node(node).parent) {
+				path.push_back(nodePool.argument(node));
+			}
+			std::reverse(path.begin(), path.end());
+			return path;
+		}
+		/**
+		 * @brief ŗǂ̌₩猋ʂgݗĂ
+		*/
+		NODISCARD SearchResult<Config> makeBestResult() const {
+			SearchResult<Config> result;
+			if (best.parent == 0) {
+				return result;
+			}
+			result.args = makePath(best);
+			result.score = best.searchArgument.score;
+			result.complete = bestComplete;
+			return result;
+		}
+
+		/**
+		 * @brief ̐[x̍ŗǂ̌L^ĒT󋵂ʒm
+		 * @details Ɛem[h̎QƂ݂̂L^A̗͕ʃXbhǂݏoꍇ̂ݑgݗĂ
+		 * @param interval oߎԁimsj
+		 * @return T𑱂ꍇtrue
+		*/
+		NODISCARD bool publish(const double interval) {
+			if (nextRanking.empty()) {
+				return not monitor->isStopRequested();
+			}
+			const auto& item = [&]() -> const RankingItem& {
+				if constexpr (Config::UseBoundedRanking()) {
+					return *std::max_element(nextRanking.begin(), nextRanking.end());
 				}
 				else {
-					if (currentRoot->patch.hasValue()) {
-						currentRoot->patch.undo();
+					return nextRanking.top();
+				}
+			}();
+			// ̐em[h͉܂ŌʂƂĎQƂ
+			nodePool.node(item.parent).addRef();
+			if (best.parent != 0) {
+				release(best.parent);
+			}
+			best = Candidate(item.parent, item.searchArgument);
+			bestComplete = remainDepth <= 0;
+			if (monitor->isWatched()) {
+				monitor->store(makeBestResult());
+			}
+
+			SearchProgress<Config> progress;
+			// Ԃ̌̐e͐[x0̒TJnÕm[h
+			progress.depth = nodePool.node(best.parent).depth;
+			progress.frontier = nextRanking.size();
+			progress.bestScore = best.searchArgument.score;
+			progress.elapsed = interval;
+			return monitor->notify(progress);
+		}
+
+		/**
+		 * @brief em[hƂĎQƂ
+		 * @return em[h̓WJ
+		*/
+		size_type referParent() {
+			// em[h̗͌LɊւ炸1xQƂ
+			if (nextParents.empty() || nextParents.back() != currentNode) {
+				nodePool.node(currentNode).addRef();
+				nextParents.push_back(currentNode);
+			}
+			return nextParents.size() - 1;
+		}
+
+		NODISCARD RankingItem makeCandidate(const SearchMethod& argument) {
+			const size_type order = referParent();
+			if constexpr (Config::UseGroupedExpansion()) {
+				return RankingItem(currentNode, argument, order);
+			}
+			else {
+				return RankingItem(currentNode, argument);
+			}
+		}
+
+		/**
+		 * @brief dp̌Widthɍi
+		*/
+		void pruneCandidates() {
+			const auto middle = nextCandidates.begin() + candidateWidth;
+			std::nth_element(nextCandidates.begin(), middle, nextCandidates.end(), std::greater<RankingItem>());
+			for (auto it = middle; it != nextCandidates.end(); ++it) {
+				reserved.find(it->searchArgument.hash)->index = InvalidIndex;
+			}
+			nextCandidates.erase(middle, nextCandidates.end());
+			forange(idx, nextCandidates.size()) {
+				reserved.find(nextCandidates[idx].searchArgument.hash)->index = idx;
+			}
+			candidateFloor = std::min_element(nextCandidates.begin(), nextCandidates.end())->searchArgument.score;
+			hasCandidateFloor = true;
+		}
+
+		/**
+		 * @brief dp̌̒Tm[hL[Ɉڂ
+		*/
+		void flushCandidates() {
+			if constexpr (Config::UseBoundedRanking()) {
+				if (candidateWidth < nextCandidates.size()) {
+					pruneCandidates();
+				}
+			}
+			nextRanking.assign(nextCandidates.begin(), nextCandidates.end());
+			nextCandidates.clear();
+			hasCandidateFloor = false;
+			if constexpr (Config::GetDedupeScope() == DedupeScope::Depth) {
+				reserved.clear();
+			}
+		}
+
+		/**
+		 * @brief dė\񂷂
+		 * @param argument T
+		*/
+		void reserveUnique(const SearchMethod& argument) {
+			if constexpr (Config::UseBoundedRanking()) {
+				if (hasCandidateFloor && not (candidateFloor < argument.score)) {
+					return;
+				}
+			}
+
+			auto [entry, inserted] = reserved.try_emplace(argument.hash);
+			if (not inserted) {
+				if (entry->depth != remainDepth) {
+					// O̐[xŗ\񂳂ꂽnbV
+					return;
+				}
+				if (entry->index != InvalidIndex) {
+					auto& item = nextCandidates[entry->index];
+					if (item.searchArgument.score < argument.score) {
+						// XRA̍Œu
+						item = makeCandidate(argument);
 					}
-					currentRoot = currentRoot->parent;
+					return;
 				}
 			}
-			forstep(idx, stack, Config::GetDepth()) {
-				WARN_PUSH_DISABLE(26446 26482);
-				redos[idx].redo();
-				WARN_POP();
+			entry->depth = remainDepth;
+			entry->index = nextCandidates.size();
+			nextCandidates.push_back(makeCandidate(argument));
+
+			if constexpr (Config::UseBoundedRanking()) {
+				if (candidateWidth * 2 <= nextCandidates.size()) {
+					pruneCandidates();
+				}
 			}
 		}
 
-		void clearRanking(Ranking& rank) {
-			for (const auto& node : rank) {
-				release(node.second);
+		NODISCARD static size_type bucketOf(const SearchMethod& argument) noexcept {
+			return Config::GetBucket(argument) % Config::GetBucketCount();
+		}
+		/**
+		 * @brief oPbg̓WJɒB
+		 * @param argument T
+		*/
+		NODISCARD bool isBucketFull(const SearchMethod& argument) const noexcept {
+			if constexpr (UseBucketCap) {
+				return Config::GetBucketCapacity() <= bucketCounts[bucketOf(argument)];
+			}
+			else {
+				return false;
+			}
+		}
+		/**
+		 * @brief oPbg̓WJ𐔂
+		 * @param argument T
+		*/
+		void countBucket(const SearchMethod& argument) noexcept {
+			if constexpr (UseBucketCap) {
+				bucketCounts[bucketOf(argument)]++;
 			}
-			rank.clear();
 		}
 
-		void release(NodePointer node) {
-			assert(node != nullptr);
-			assert(0 < node->ref);
+		/**
+		 * @brief WJm[hƂđIׂ邩
+		 * @details Tς݂̃nbV͑I΂A_̌Ŗ߂
+		 * @param argument T
+		*/
+		NODISCARD bool filterLayer(const SearchMethod& argument) {
+			if constexpr (UseLayerFilter()) {
+				if (not layerVisited->insert(argument.hash)) {
+					stats.addSkipped();
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/**
+		 * @brief ̐[xœWJm[hIсAem[h̓WJɕׂ
+		*/
+		void arrangeLayer() {
+			currentLayer.clear();
+			layerCursor = 0;
+			if constexpr (Config::UseBoundedRanking()) {
+				currentLayer.assign(nextRanking.begin(), nextRanking.end());
+				if constexpr (UseBucketCap || UseLayerFilter()) {
+					// XRAɃoPbg̏ƏdKp
+					std::sort(currentLayer.begin(), currentLayer.end(), std::greater<RankingItem>());
+					size_type size = 0;
+					for (const auto& item : currentLayer) {
+						if (layerWidth <= size) {
+							break;
+						}
+						if (not isBucketFull(item.searchArgument) && filterLayer(item.searchArgument)) {
+							countBucket(item.searchArgument);
+							currentLayer[size] = item;
+							size++;
+						}
+					}
+					currentLayer.resize(size);
+				}
+				else if (layerWidth < currentLayer.size()) {
+					// WJɕׂOɁAԔzŋ߂̏ʂ̂ݎc
+					const auto nth = currentLayer.begin() + layerWidth;
+					std::nth_element(currentLayer.begin(), nth, currentLayer.end(), std::greater<RankingItem>());
+					currentLayer.erase(nth, currentLayer.end());
+				}
+			}
+			else {
+				while (currentLayer.size() < layerWidth && not nextRanking.empty()) {
+					const auto& item = nextRanking.top();
+					if (not isBucketFull(item.searchArgument) && filterLayer(item.searchArgument)) {
+						countBucket(item.searchArgument);
+						currentLayer.push_back(item);
+					}
+					nextRanking.pop();
+				}
+			}
+			nextRanking.clear();
+
+			std::sort(currentLayer.begin(), currentLayer.end(), [](const RankingItem& a, const RankingItem& b) {
+				if (a.order != b.order) {
+					return a.order < b.order;
+				}
+				return b < a;
+			});
+		}
 
-			if (node->ref == 1) {
-				if (node->parent != nullptr) { release(node->parent); }
-				if (node->patch.hasValue()) { IMemo::Get().release(node->patch); }
-				nodePool.release(node);
+		NODISCARD bool emptyCurrent() const noexcept {
+			if constexpr (Config::UseGroupedExpansion()) {
+				return currentLayer.size() <= layerCursor;
 			}
 			else {
-				node->subRef();
+				return currentRanking.empty();
 			}
 		}
+
+		template<class Rank>
+		void clearRanking(Rank& rank, std::vector<NodeIndex>& parents) {
+			for (const auto node : parents) {
+				release(node);
+			}
+			parents.clear();
+			rank.clear();
+		}
+
+		/**
+		 * @brief m[h̎QƂOAQƂȂc܂ł
+		 * @details em[hċAɂǂApb` reclaim ł܂Ƃ߂ĉ
+		*/
+		void release(const NodeIndex index) {
+			ReleaseNode(nodePool, index, [&](const NodeIndex released, const CompactSearchNode& node) {
+				if (node.hasPatch()) { deadPatches.push_back(node.patchData); }
+				if constexpr (UseCheckpoint || UseStateCopy) {
+					checkpoints.release(released);
+				}
+			});
+		}
+
+		/**
+		 * @brief m[h̃pb`܂Ƃ߂ĉ
+		 * @details AhXɕׁAy[W̃pb`܂Ƃ߂ĉ
+		*/
+		void reclaim() {
+			if (deadPatches.empty()) {
+				return;
+			}
+			std::sort(deadPatches.begin(), deadPatches.end());
+			memo.release(deadPatches.begin(), deadPatches.end());
+			deadPatches.clear();
+		}
 	public:
+		/**
+		 * @brief WJm[hIԎɃnbV̏d
+		 * @details em[h̓WJł͐[xƂɓWJm[hɑIԂ߁AIԎɏdĎ_̌Ŗ߂
+		*/
+		NODISCARD static constexpr bool UseLayerFilter() noexcept {
+			return Config::HasHash() && Config::UseGroupedExpansion();
+		}
+		/**
+		 * @brief WJm[hIԎɏdTς݃nbVݒ肷
+		 * @param visited Tς݃nbViUseLayerFilter() ̏ꍇ͒TɎQƂj
+		*/
+		void setLayerFilter(VisitedSet& visited) noexcept {
+			layerVisited = std::addressof(visited);
+		}
+
+		/**
+		 * @brief ĂяoXbhɎgMemooCh
+		 * @details TԂ̌^̒Tsł悤ɁAT͎gMemoɋL^
+		 * @return jƌMemoɖ߂oCh
+		*/
+		NODISCARD typename IMemo::Binding bindMemo() noexcept {
+			return typename IMemo::Binding(memo);
+		}
+
 		void timerStart() noexcept {
 			timer.start();
 		}
 
 		void init() {
-			remainDepth = narrow_cast<decltype(remainDepth)>(Config::GetDepth());
+			if constexpr (UseStateCopy) {
+				// ̈悪ƏԑJڂłȂ
+				if (not checkpoints.enabled()) {
+					throw std::logic_error("Config::UseStateCopy() requires setSearchState()");
+				}
+			}
+			remainDepth = narrow_cast<decltype(remainDepth)>(searchDepth());
+			if constexpr (UseRuntime) {
+				redos.resize(searchDepth());
+				if constexpr (UseCheckpoint) {
+					undos.resize(searchDepth());
+				}
+			}
 			const auto interval = timer.interval();
-			nextLimit = getNextLimit(interval);
+			candidateWidth = widthAt(-1);
+			schedule.reset(static_cast<double>(searchLimit()), interval);
+			applyPlan(interval);
+			reserveLayers();
 
-			currentNode = new(nodePool.alloc()) Node();
+			currentNode = nodePool.create();
 
-			clearRanking(currentRanking);
-			clearRanking(nextRanking);
+			clearRanking(currentRanking, currentParents);
+			clearRanking(nextRanking, nextParents);
+			if (best.parent != 0) {
+				release(best.parent);
+				best = Candidate();
+			}
+			bestComplete = false;
+			reclaim();
+			if constexpr (UseCheckpoint || UseStateCopy) {
+				checkpoints.clear();
+			}
+			nextCandidates.clear();
+			reserved.clear();
+			hasCandidateFloor = false;
+			currentLayer.clear();
+			layerCursor = 0;
+			hasCandidate = false;
 			nodeWidthCount = 0;
+			transitionCounter = TransitionCounter();
+			stats.clear();
+			monitor->reset();
 
-			IMemo::Get().lock();
+			if constexpr (not UseStateCopy) {
+				memo.lock();
+			}
 		}
 
 		NODISCARD bool onloop() {
-			if (nextNode != nullptr) {
+			if (hasCandidate) {
 				// nbVvŃXLbvꂽꍇ
-				release(nextNode);
-				nextNode = nullptr;
+				hasCandidate = false;
+				stats.addSkipped();
+			}
+			else if constexpr (UseStateCopy) {
+				stats.endSearch();
+				checkpoints.save(currentNode);
 			}
 			else {
-				currentNode->patch = IMemo::Get().commit();
+				stats.endSearch();
+				const auto patch = memo.commit();
+				nodePool.node(currentNode).setPatch(patch);
+				stats.addCommitted(patch.size());
+				if constexpr (UseCheckpoint) {
+					if (checkpoints.enabled()) {
+						recordCheckpoint(currentNode);
+					}
+				}
+			}
+
+			if (monitor->isStopRequested()) {
+				destruction(timer.interval());
+				return false;
 			}
 
-			const double interval = timer.interval();
-			if (nextLimit <= interval || currentRanking.empty() || nodeWidthCount >= Config::GetWidth()) {
-				if (remainDepth <= 0) {
+			if constexpr (UseBucketCap && not Config::UseGroupedExpansion()) {
+				// ɒBoPbǧ͓WJȂ
+				while (not currentRanking.empty() && isBucketFull(currentRanking.top().searchArgument)) {
+					currentRanking.pop();
+				}
+			}
+
+			// ̓ǂݏoԈĒߐ؂𔻒肷
+			if (timer.reached(nextLimit) || emptyCurrent() || nodeWidthCount >= layerWidth) {
+				const double interval = timer.interval();
+				if constexpr (UseReserveDedupe) {
+					flushCandidates();
+				}
+				if (not publish(interval) || remainDepth <= 0) {
 					destruction(interval);
 					return false;
 				}
 
-				nextLimit = getNextLimit(interval);
+				schedule.record(nodeWidthCount, interval);
+				applyPlan(interval);
 				remainDepth--;
-				clearRanking(currentRanking);
-				std::swap(currentRanking, nextRanking);
+				candidateWidth = widthAt(getDepth() + 1);
+				stats.beginDepth(getDepth() + 1, interval);
+				if constexpr (UseStateCopy) {
+					// WJI[x̃m[hւ͑JڂȂ
+					for (const auto node : currentParents) {
+						checkpoints.release(node);
+					}
+				}
+				clearRanking(currentRanking, currentParents);
+				reclaim();
+				if constexpr (UseBucketCap) {
+					bucketCounts.fill(0);
+				}
+				if constexpr (Config::UseGroupedExpansion()) {
+					arrangeLayer();
+				}
+				else if constexpr (Config::UseBoundedRanking()) {
+					currentRanking.assign(nextRanking.begin(), nextRanking.end());
+					nextRanking.clear();
+				}
+				else {
+					peakFrontier = std::max(peakFrontier, nextRanking.size());
+					std::swap(currentRanking, nextRanking);
+					// ւL[O̐[x܂ł̍ő̌␔Ŋmۂ
+					nextRanking.reserve(peakFrontier);
+				}
+				std::swap(currentParents, nextParents);
 				nodeWidthCount = 0;
 			}
 
-			if (currentRanking.empty()) {
-				destruction(interval);
+			if (emptyCurrent()) {
+				destruction(timer.interval());
 				return false;
 			}
 
-			nextNode = currentRanking.top().second;
-			currentRanking.pop();
+			if constexpr (Config::UseGroupedExpansion()) {
+				nextCandidate = currentLayer[layerCursor];
+				layerCursor++;
+			}
+			else {
+				nextCandidate = currentRanking.top();
+				currentRanking.pop();
+			}
+			hasCandidate = true;
 
 			return true;
 		}
 
 		void accept() {
-			assert(nextNode != nullptr);
+			assert(hasCandidate);
 			nodeWidthCount++;
+			if constexpr (not Config::UseGroupedExpansion()) {
+				countBucket(nextCandidate.searchArgument);
+			}
+			// I΂ꂽ̂݃m[h쐬
+			const NodeIndex nextNode = nodePool.create(nextCandidate.parent, nextCandidate.searchArgument.argument);
 			transitin(currentNode, nextNode);
 			release(currentNode);
 			currentNode = nextNode;
-			nextNode = nullptr;
+			hasCandidate = false;
+			stats.addAccepted();
+			// onloop܂łT
+			stats.beginSearch();
 		}
 
 		void reserve(const SearchMethod& argument) {
-			NodePointer ptr = new(nodePool.alloc()) Node(currentNode, argument);
-			nextRanking.emplace(argument.score, ptr);
+			stats.addReserved();
+			if constexpr (UseReserveDedupe) {
+				reserveUnique(argument);
+				return;
+			}
+			if constexpr (Config::UseBoundedRanking()) {
+				if (candidateWidth <= nextRanking.size()) {
+					// ȉ̌͋L^Ɋp
+					if (not (nextRanking.top().searchArgument.score < argument.score)) {
+						return;
+					}
+					nextRanking.pop();
+				}
+			}
+			nextRanking.push(makeCandidate(argument));
 		}
 
 		NODISCARD const SearchMethod& getArgument() const noexcept {
-			assert(nextNode != nullptr);
-			return nextNode->searchArgument;
+			assert(hasCandidate);
+			return nextCandidate.searchArgument;
 		}
 		NODISCARD bool endOfSearch() const noexcept {
 			return remainDepth == 0;
 		}
 		NODISCARD int getDepth() const noexcept {
-			return narrow_cast<int>(Config::GetDepth()) - remainDepth - 2;
+			return narrow_cast<int>(searchDepth()) - remainDepth - 2;
 		}
 
-		NODISCARD std::vector<ArgumentType> getResultList() const {
-			if (nextRanking.empty()) {
-				return std::vector<ArgumentType>();
-			}
-			else {
-				std::vector<ArgumentType> args(Config::GetDepth());
-				const auto& top = nextRanking.top();
-				NodePointer node = top.second;
-				forange(depth, Config::GetDepth()) {
-					args[Config::GetDepth() - 1 - depth] = node->searchArgument.argument;
-					if (node->parent == nullptr) {
-						break;
-					}
-					node = node->parent;
-				}
-				return args;
+		/**
+		 * @brief Ԃ̗̈o^
+		 * @param data ̈̐擪
+		 * @param size ̈̃TCYibytej
+		 * @note ԑŜ̕ƃ`FbN|Cgł̂ݎgAȊOł͖
+		*/
+		void setStateRegion(void* data, const size_type size) {
+			if constexpr (UseCheckpoint || UseStateCopy) {
+				checkpoints.setRegion(data, size);
 			}
 		}
 
+		/**
+		 * @brief Tp[^ݒ肷
+		 * @param value ̒TgT[xEr[ET
+		 * @note Config::UseRuntimeParameters() ̏ꍇ̂ݎg
+		*/
+		void setParameters(const SearchParameters& value) {
+			static_assert(UseRuntime, "Config::UseRuntimeParameters() is false");
+			assert(0 < value.depth);
+			assert(0 < value.width);
+			parameters = value;
+		}
+		/**
+		 * @brief Tp[^
+		*/
+		NODISCARD SearchParameters getParameters() const noexcept {
+			return parameters;
+		}
+
+		/**
+		 * @brief ԑJڂœKppb`
+		 * @return pb`
+		*/
+		NODISCARD const TransitionCounter& getTransitionCounter() const noexcept {
+			return transitionCounter;
+		}
+
+		/**
+		 * @brief T̓v
+		 * @note Config::GetDebug() ̏ꍇ̂݋L^
+		*/
+		NODISCARD const SearchStats<Config::GetDebug()>& getStats() const noexcept {
+			return stats;
+		}
+
+		/**
+		 * @brief ŗǂ̌܂ł̈
+		 * @note T͒O̐[x̐؂ւ_̌ʂԂ
+		*/
+		NODISCARD std::vector<ArgumentType> getResultList() const {
+			return getBestResult().args;
+		}
+		/**
+		 * @brief T̍ŗǂ̌
+		 * @note ʃXbhĂяoBT̕ʃXbh̏̌ĂяóA̐[x̐؂ւŌʂgݗĂ܂ő҂
+		*/
+		NODISCARD SearchResult<Config> getBestResult() const {
+			SearchResult<Config> result;
+			if (monitor->waitBest(result)) {
+				return result;
+			}
+			return makeBestResult();
+		}
+		/**
+		 * @brief [xƂ̒T󋵂̒ʒmݒ肷
+		 * @param callback ʒmifalseԂƒTIj
+		*/
+		void setProgressCallback(typename SearchMonitor<Config>::Callback callback) {
+			monitor->setCallback(std::move(callback));
+		}
+		/**
+		 * @brief T̏Iv
+		 * @note ʃXbhĂяo
+		*/
+		void requestStop() noexcept {
+			monitor->requestStop();
+		}
 
 	};
 }
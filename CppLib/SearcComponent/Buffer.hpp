@@ -1,6 +1,11 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include "SearchComponentLib.hpp"
 #include "Patch.hpp"
@@ -8,6 +13,14 @@
 
 namespace alib::Search::Lib {
 
+	/**
+	 * @brief ύXL^obt@
+	 * @details 1̃pb`쐬̊ԂɓAhXƃTCYւ̕ύX𕡐L^ꍇ͍ŏ1̂ݎc
+	 * iύXO̒l͍ŏ̋L^AύX̒l̓pb`쐬̒lɂȂj
+	 * L^obt@Ɏ܂Ȃꍇ͒ǉ̗̈AċL^𑱂iǉ̗̈̓pb`쐬ėpj
+	 * @tparam Count obt@TCYibytej
+	 * @tparam MemoSize L^TCY̌^
+	*/
 	template<size_type Count, typename MemoSize = unsigned short>
 	class Buffer {
 	public:
@@ -15,25 +28,153 @@ namespace alib::Search::Lib {
 		using pointer = Stream::pointer;
 
 		using MemoSizeType = MemoSize;
+		using PatchType = Patch<MemoSizeType>;
+		using OffsetType = typename PatchType::OffsetType;
 	private:
+		/** @brief L^ς݃AhX̕\̑傫̃rbg */
+		static constexpr int TableBits = 9;
+		static constexpr size_type TableSize = static_cast<size_type>(1) << TableBits;
+
+		/**
+		 * @brief L^ς݃AhX
+		*/
+		struct Recorded {
+			void* address = nullptr;
+			/** @brief L^i݂̐ƈvꍇ̂ݗLj */
+			std::uint32_t generation = 0;
+			MemoSizeType size = 0;
+		};
+
+		/**
+		 * @brief ǉ̏ݗ̈
+		*/
+		struct Chunk {
+			std::unique_ptr<value_type[]> data{};
+			size_type size = 0;
+		};
+
 		/** @brief ύXe݃Xg[ */
 		Stream stream{};
 
 		/** @brief ύXe݃obt@ */
 		value_type buffer[Count]{};
 
+		/** @brief ǉ̏ݗ̈i擪珇Ɏgj */
+		std::vector<Chunk> chunks{};
+		/** @brief ݂Ï̃Xg[iÖ̗j */
+		std::vector<Stream> spilled{};
+		/** @brief ݂Ï̋L^TCY̍v */
+		size_type spilledSize = 0;
+
 		/** @brief L^JntO */
 		bool isLocked = false;
 
 		/** @brief ߂obt@TCY */
 		size_type modiftSize = 0;
 
+		/** @brief L^ */
+		size_type recordCount = 0;
+		/** @brief L^AhX͈̔ */
+		std::uintptr_t minAddress = 0;
+		std::uintptr_t maxAddress = 0;
+
+		/**
+		 * @brief SĂ̋L^̃AhX̍ OffsetType Ɏ܂邩
+		*/
+		NODISCARD bool isNear() const noexcept {
+			return maxAddress - minAddress <= static_cast<std::uintptr_t>(std::numeric_limits<OffsetType>::max());
+		}
+
+		/** @brief L^ς݃AhX̕\ */
+		Recorded recorded[TableSize]{};
+		/** @brief ݂̐ */
+		std::uint32_t generation = 1;
+		/** @brief L^ς݃AhX */
+		size_type recordedCount = 0;
+
+		/**
+		 * @brief L^ς݂肵AL^̏ꍇ͓o^
+		 * @return AhXƃTCYL^ς݂̏ꍇtrue
+		 * @note \̎gp𒴂͓o^ɏfalseԂ
+		*/
+		NODISCARD bool isRecorded(void* data, const size_type size) noexcept {
+			WARN_PUSH_DISABLE(26490);
+			const auto key = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(data));
+			WARN_POP();
+			for (size_type idx = static_cast<size_type>((key * 0x9E3779B97F4A7C15ull) >> (64 - TableBits));; idx = (idx + 1) & (TableSize - 1)) {
+				auto& slot = recorded[idx];
+				if (slot.generation != generation) {
+					if (TableSize <= recordedCount * 2) {
+						return false;
+					}
+					slot.address = data;
+					slot.size = narrow_cast<MemoSizeType>(size);
+					slot.generation = generation;
+					recordedCount++;
+					return false;
+				}
+				if (slot.address == data && slot.size == size) {
+					return true;
+				}
+			}
+		}
+
+		/**
+		 * @brief ̗̈ɏ݂؂ւ
+		 * @param writeSize ̗̈ɏދL^̃TCY
+		*/
+		void spill(const size_type writeSize) {
+			const size_type index = spilled.size();
+			if (chunks.size() <= index) {
+				chunks.emplace_back();
+			}
+			auto& chunk = chunks[index];
+			if (chunk.size < writeSize) {
+				// 1̋L^͗̈܂Ȃ߁A傫ȋL^ɂ͗̈蒼
+				chunk.size = std::max(Count, writeSize);
+				chunk.data = std::make_unique<value_type[]>(chunk.size);
+			}
+			spilledSize += stream.size();
+			spilled.push_back(stream);
+			stream = Stream(chunk.data.get(), chunk.size);
+		}
+
+		/**
+		 * @brief L^ς݃AhXSč폜
+		*/
+		void clearRecorded() noexcept {
+			recordedCount = 0;
+			generation++;
+			if (generation == 0) {
+				// ԍꍇ̂ݑŜ
+				for (auto& slot : recorded) {
+					slot.generation = 0;
+				}
+				generation = 1;
+			}
+		}
+
 	public:
 		Buffer() noexcept {
 			WARN_PUSH_DISABLE(26485);
 			stream = Stream(buffer, Count);
 			WARN_POP();
 		}
+		Buffer(const Buffer&) = delete;
+		Buffer& operator=(const Buffer&) = delete;
+		/**
+		 * @brief ǉ̗݈̈̂p
+		 * @note L^ipb`쐬Oj͈ړȂ
+		*/
+		Buffer(Buffer&& o) noexcept : Buffer() {
+			*this = std::move(o);
+		}
+		Buffer& operator=(Buffer&& o) noexcept {
+			assert(o.stream.size() == 0 && o.spilled.empty());
+			chunks = std::move(o.chunks);
+			isLocked = o.isLocked;
+			return *this;
+		}
 
 		void lock() noexcept { isLocked = true; }
 		void unlock() noexcept { isLocked = false; }
@@ -50,13 +191,32 @@ namespace alib::Search::Lib {
 
 			assert(0 < size);
 			assert(size < std::numeric_limits<MemoSizeType>::max() - (sizeof(MemoSizeType) + sizeof(void*)));
-			assert(writeSize <= stream.capacity());
+
+			if (isRecorded(data, size)) {
+				return;
+			}
+			if (stream.capacity() < writeSize) {
+				spill(writeSize);
+			}
 
 			stream.copy(data, size);
 			stream.set<MemoSizeType>(narrow_cast<MemoSizeType>(size));
 			stream.set<void*>(data);
 
 			modiftSize += size;
+
+			WARN_PUSH_DISABLE(26490);
+			const auto address = reinterpret_cast<std::uintptr_t>(data);
+			WARN_POP();
+			if (recordCount == 0) {
+				minAddress = address;
+				maxAddress = address;
+			}
+			else {
+				minAddress = std::min(minAddress, address);
+				maxAddress = std::max(maxAddress, address);
+			}
+			recordCount++;
 		}
 
 		/**
@@ -64,21 +224,52 @@ namespace alib::Search::Lib {
 		 * @return pb`TCY
 		*/
 		size_type wholeSize() const noexcept {
-			return stream.size() + modiftSize;
+			const size_type size = stream.size() + spilledSize + modiftSize;
+			if (recordCount <= 1) {
+				return size;
+			}
+			// 擪ȊŐL^̓AhX̑ɂ
+			if (isNear()) {
+				return size - (recordCount - 1) * (sizeof(void*) - sizeof(OffsetType));
+			}
+			else {
+				return size + (recordCount - 1) * sizeof(OffsetType);
+			}
 		}
 
 		/**
 		 * @brief pb`쐬
 		 * @param buf ݐ̃obt@
+		 * @param shift L^AhX獷ibytej
 		 * @return pb`
 		*/
-		Patch<MemoSizeType> commit(Stream buf) noexcept {
+		Patch<MemoSizeType> commit(Stream buf, const std::ptrdiff_t shift = 0) noexcept {
 			assert(isLocked);
 
+			const bool near = isNear();
+			void* base = nullptr;
 			while (buf.hasStream()) {
+				while (stream.size() == 0) {
+					// ォ珑񂾗̈悩珇ɓǂݏo
+					stream = spilled.back();
+					spilled.pop_back();
+				}
 				// L^Ώۂ̃|C^
 				const auto ptr = stream.pop<void*>();
-				buf.set<void*>(ptr);
+				if (base == nullptr) {
+					base = ptr;
+					buf.set<void*>(ShiftPointer(ptr, -shift));
+				}
+				else if (near) {
+					WARN_PUSH_DISABLE(26490);
+					const auto offset = reinterpret_cast<std::intptr_t>(ptr) - reinterpret_cast<std::intptr_t>(base);
+					WARN_POP();
+					buf.set<OffsetType>(static_cast<OffsetType>(offset));
+				}
+				else {
+					buf.set<OffsetType>(PatchType::FarOffset);
+					buf.set<void*>(ShiftPointer(ptr, -shift));
+				}
 
 				// L^TCY
 				const auto size = stream.pop<MemoSizeType>();
@@ -88,10 +279,18 @@ namespace alib::Search::Lib {
 				stream.pop(buf, size);// ύXO̒l
 			}
 			assert(buf.endOfStream());
+			// 傫ȋL^Ő؂ւꍇ̗͋̈悪c
+			spilled.clear();
+			WARN_PUSH_DISABLE(26485);
+			stream = Stream(buffer, Count);
+			WARN_POP();
+			spilledSize = 0;
 			modiftSize = 0;
+			recordCount = 0;
+			clearRecorded();
 
 			auto [first, last] = buf.data();
-			return Patch<MemoSizeType>(first, last);
+			return PatchType(first, last);
 		}
 	};
 
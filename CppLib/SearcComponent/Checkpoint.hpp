@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "SearchComponentLib.hpp"
+
+namespace alib::Search::Lib {
+
+	/**
+	 * @brief m[hƂ̏Ԃ̕i`FbN|Cgj̊Ǘ
+	 * @details o^̈m[h̔ԍƂɕA̖m[h̓`FbN|Cg̍̍vTCY
+	 * ԑŜ̕iConfig::UseStateCopy()jł͑Sm[h̏Ԃ̕ۑɂȂ
+	 * @note ͍̈L^lSĊ܂݁AÕQƂȂ
+	*/
+	class CheckpointStore {
+	public:
+		using index_type = std::uint32_t;
+	private:
+		/** @brief ̈ */
+		std::byte* region = nullptr;
+		size_type regionSize = 0;
+
+		/** @brief ̕ۑï̑傫Ƃ̘gj */
+		std::vector<std::byte> storage{};
+		/** @brief gp̘g */
+		std::vector<index_type> freeSlots{};
+		/** @brief m[h̘gi0͖AȊO͘g̔ԍ+1j */
+		std::vector<index_type> slots{};
+		/** @brief `FbN|Cg̍̍vTCYibytej */
+		std::vector<size_type> bytes{};
+
+		void ensure(const index_type index) {
+			if (slots.size() <= index) {
+				slots.resize(static_cast<size_type>(index) + 1, 0);
+				bytes.resize(static_cast<size_type>(index) + 1, 0);
+			}
+		}
+		NODISCARD std::byte* slotData(const index_type slot) noexcept {
+			return storage.data() + static_cast<size_type>(slot) * regionSize;
+		}
+		NODISCARD const std::byte* slotData(const index_type slot) const noexcept {
+			return storage.data() + static_cast<size_type>(slot) * regionSize;
+		}
+	public:
+		/**
+		 * @brief ̈o^
+		 * @param data ̈̐擪
+		 * @param size ̈̃TCYibytej
+		*/
+		void setRegion(void* data, const size_type size) {
+			region = static_cast<std::byte*>(data);
+			regionSize = size;
+			storage.clear();
+			freeSlots.clear();
+			slots.clear();
+			bytes.clear();
+		}
+		NODISCARD bool enabled() const noexcept { return region != nullptr && 0 < regionSize; }
+		NODISCARD size_type size() const noexcept { return regionSize; }
+
+		/**
+		 * @brief SĂ̕j
+		 * @note ۑ͍̃ėp
+		*/
+		void clear() {
+			freeSlots.clear();
+			const size_type count = regionSize == 0 ? 0 : storage.size() / regionSize;
+			forange(slot, count) {
+				freeSlots.push_back(narrow_cast<index_type>(count - 1 - slot));
+			}
+			slots.assign(slots.size(), 0);
+			bytes.assign(bytes.size(), 0);
+		}
+
+		NODISCARD bool has(const index_type index) const noexcept {
+			return index < slots.size() && slots[index] != 0;
+		}
+
+		/**
+		 * @brief ݂̗̈m[h̕Ƃĕۑ
+		 * @param index m[h̔ԍ
+		*/
+		void save(const index_type index) {
+			assert(enabled());
+			ensure(index);
+			if (slots[index] == 0) {
+				if (freeSlots.empty()) {
+					freeSlots.push_back(narrow_cast<index_type>(storage.size() / regionSize));
+					storage.resize(storage.size() + regionSize);
+				}
+				slots[index] = freeSlots.back() + 1;
+				freeSlots.pop_back();
+			}
+			std::memcpy(slotData(slots[index] - 1), region, regionSize);
+			bytes[index] = 0;
+		}
+		/**
+		 * @brief m[ḧ̕ɖ߂
+		 * @param index m[h̔ԍ
+		*/
+		void restore(const index_type index) const noexcept {
+			assert(has(index));
+			std::memcpy(region, slotData(slots[index] - 1), regionSize);
+		}
+		/**
+		 * @brief m[h̕ƋL^j
+		 * @param index m[h̔ԍ
+		*/
+		void release(const index_type index) {
+			if (index < slots.size()) {
+				if (slots[index] != 0) {
+					freeSlots.push_back(slots[index] - 1);
+					slots[index] = 0;
+				}
+				bytes[index] = 0;
+			}
+		}
+
+		/**
+		 * @brief `FbN|Cg̍̍vTCYibytej
+		 * @param index m[h̔ԍ
+		*/
+		NODISCARD size_type getBytes(const index_type index) const noexcept {
+			return index < bytes.size() ? bytes[index] : 0;
+		}
+		void setBytes(const index_type index, const size_type size) {
+			ensure(index);
+			bytes[index] = size;
+		}
+	};
+
+}
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <vector>
+
+#include "SearchConfig.hpp"
+#include "SearchComponentLib.hpp"
+#include "SearchNode.hpp"
+#include "ExPriorityQueue.hpp"
+#include "Timer.hpp"
+
+namespace alib::Search::Lib {
+
+	/**
+	 * @brief chokudaiT[`
+	 * @details [xƂ̗DxtL[Ԃς܂ŌJԂ
+	 * @note Config::GetWidth() 1̑Ŋe[xom[h
+	 * @tparam Config
+	*/
+	template<class ConfigClass, class Space>
+	class ChokudaiSearchProcess {
+	public:
+		using Config = ConfigClass;
+		using SpaceType = Space;
+	private:
+		using ArgumentType = typename Config::ArgumentType;
+		using SearchMethod = typename Config::SearchMethod;
+		using NodePool = CompactNodePool<ArgumentType>;
+		using NodeIndex = typename NodePool::index_type;
+		using Candidate = SearchCandidate<Config, NodeIndex>;
+		using Ranking = ExPriorityQueue<Candidate>;
+		using IMemo = MemoSingleton<Space>;
+		static_assert(not Config::UseStateCopy(), "Config::UseStateCopy() is supported only by BeamSearchProcess");
+
+		/** @brief [xƂ̒Tm[hL[Ɏc␔ */
+		static constexpr size_type QueueCapacity = Config::GetQueueCapacity();
+		static_assert(0 < QueueCapacity, "Config::GetQueueCapacity() must be positive");
+
+		/** @brief ݂̒Tm[h */
+		NodeIndex currentNode = 0;
+		/** @brief ̒Tim[h accept ō쐬j */
+		Candidate nextCandidate{};
+		/** @brief ̒Toς */
+		bool hasCandidate = false;
+
+		/** @brief [xƂ̒Tm[hL[i͍ŏI[x̌ŁA͐em[h̎QƂj */
+		std::array<Ranking, Config::GetDepth() + 1> rankings;
+		/** @brief Tm[hL[ʂ̌ɍiꎞ̈ */
+		std::vector<Candidate> trimBuffer;
+		/** @brief ̐[xiO-1j */
+		int layer = -1;
+		/** @brief ̐[xom[h */
+		size_type layerCount = 0;
+		/** @brief  */
+		size_type sweepCount = 0;
+
+		/** @brief T^C}[ */
+		DeadlineTimer timer{ Config::GetTimeTolerance() };
+		/** @brief m[hǗ */
+		NodePool nodePool;
+		/** @brief TԂ̕ύX̋L^iT bindMemo ŌĂяoXbhɃoChj */
+		Memo memo;
+		/** @brief ԑJڂœKppb`̈ꎞ̈ */
+		std::array<Memo::PatchType, Config::GetDepth()> redos{};
+
+		void destruction() {
+			release(currentNode);
+			currentNode = 0;
+			memo.unlock();
+		}
+
+		/**
+		 * @brief ԑJ
+		 * @param current Jڌ
+		 * @param next Jڐ
+		*/
+		void transitin(const NodeIndex current, const NodeIndex next) noexcept {
+			assert(next != 0);
+			assert(nodePool.node(next).parent != 0);
+			assert(!nodePool.node(next).hasPatch());
+
+			const auto path = CollectTransition(nodePool, current, nodePool.node(next).parent, redos, [](const Memo::PatchType& patch) noexcept {
+				patch.undo();
+			});
+			ApplyRedos(redos, path.first);
+		}
+
+		void clearRanking(Ranking& rank) {
+			for (const auto& item : rank) {
+				release(item.parent);
+			}
+			rank.clear();
+		}
+
+		/**
+		 * @brief Tm[hL[ʂ̌ɍi
+		 * @details c␔2{ɒBꍇ̂ݍiÂĂ̐em[h̎QƂO
+		*/
+		void trimRanking(Ranking& rank) {
+			if (rank.size() < QueueCapacity * 2) {
+				return;
+			}
+			trimBuffer.assign(rank.begin(), rank.end());
+			const auto middle = trimBuffer.begin() + QueueCapacity;
+			std::nth_element(trimBuffer.begin(), middle, trimBuffer.end(), std::greater<Candidate>());
+			for (auto it = middle; it != trimBuffer.end(); ++it) {
+				release(it->parent);
+			}
+			rank.assign(trimBuffer.begin(), middle);
+			trimBuffer.clear();
+		}
+
+		/**
+		 * @brief m[h̎QƂOAQƂȂc܂ł
+		*/
+		void release(const NodeIndex index) {
+			ReleaseNode(nodePool, index, [&](NodeIndex, const CompactSearchNode& node) {
+				if (node.hasPatch()) { memo.release(node.patch()); }
+			});
+		}
+		/**
+		 * @brief ɓWJ[x֐i߂
+		 * @return WJłm[h݂ꍇtrue
+		*/
+		NODISCARD bool advance() noexcept {
+			constexpr int lastLayer = narrow_cast<int>(Config::GetDepth());
+			if (layer < 0) {
+				layer = 0;
+				layerCount = 0;
+			}
+			forange(step, lastLayer) {
+				if (layerCount < Config::GetWidth() && not rankings[layer].empty()) {
+					return true;
+				}
+				layer++;
+				layerCount = 0;
+				if (lastLayer <= layer) {
+					layer = 0;
+					sweepCount++;
+				}
+			}
+			return layerCount < Config::GetWidth() && not rankings[layer].empty();
+		}
+	public:
+		/**
+		 * @brief ĂяoXbhɎgMemooCh
+		 * @details TԂ̌^̒Tsł悤ɁAT͎gMemoɋL^
+		 * @return jƌMemoɖ߂oCh
+		*/
+		NODISCARD typename IMemo::Binding bindMemo() noexcept {
+			return typename IMemo::Binding(memo);
+		}
+
+		void timerStart() noexcept {
+			timer.start();
+		}
+
+		void init() {
+			if (currentNode != 0) {
+				destruction();
+			}
+			for (auto& rank : rankings) {
+				clearRanking(rank);
+			}
+			currentNode = nodePool.create();
+			layer = -1;
+			layerCount = 0;
+			sweepCount = 0;
+
+			memo.lock();
+		}
+
+		NODISCARD bool onloop() {
+			if (hasCandidate) {
+				// nbVvŃXLbvꂽꍇ
+				release(nextCandidate.parent);
+				hasCandidate = false;
+			}
+			else {
+				nodePool.node(currentNode).setPatch(memo.commit());
+			}
+
+			// ŏ̑͌ʂ𓾂邽ߎԂɊւ炸Ō܂ōs
+			if (0 < sweepCount && timer.reached(Config::GetLimit())) {
+				destruction();
+				return false;
+			}
+
+			if (not advance()) {
+				destruction();
+				return false;
+			}
+
+			nextCandidate = rankings[layer].top();
+			rankings[layer].pop();
+			hasCandidate = true;
+			layerCount++;
+
+			return true;
+		}
+
+		void accept() {
+			assert(hasCandidate);
+			const NodeIndex nextNode = nodePool.create(nextCandidate.parent, nextCandidate.searchArgument.argument);
+			// ₪Ăem[h̎QƂ͍쐬m[hɈڂ
+			release(nextCandidate.parent);
+			transitin(currentNode, nextNode);
+			release(currentNode);
+			currentNode = nextNode;
+			hasCandidate = false;
+		}
+
+		void reserve(const SearchMethod& argument) {
+			auto& rank = rankings[layer + 1];
+			nodePool.node(currentNode).addRef();
+			rank.emplace(currentNode, argument);
+			trimRanking(rank);
+		}
+
+		NODISCARD const SearchMethod& getArgument() const noexcept {
+			assert(hasCandidate);
+			return nextCandidate.searchArgument;
+		}
+		NODISCARD bool endOfSearch() const noexcept {
+			return layer == narrow_cast<int>(Config::GetDepth()) - 1;
+		}
+		NODISCARD int getDepth() const noexcept {
+			return layer - 1;
+		}
+
+		NODISCARD std::vector<ArgumentType> getResultList() const {
+			const auto& result = rankings[Config::GetDepth()];
+			if (result.empty()) {
+				return std::vector<ArgumentType>();
+			}
+			else {
+				// ŏI[x̌ƁATJnÕm[hƏԂ̃m[hc̈
+				std::vector<ArgumentType> args(Config::GetDepth());
+				const auto& top = result.top();
+				args[Config::GetDepth() - 1] = top.searchArgument.argument;
+				NodeIndex node = top.parent;
+				forange(depth, Config::GetDepth() - 1) {
+					args[Config::GetDepth() - 2 - depth] = nodePool.argument(node);
+					node = nodePool.node(node).parent;
+				}
+				return args;
+			}
+		}
+	};
+}
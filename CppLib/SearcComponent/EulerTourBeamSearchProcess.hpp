@@ -0,0 +1,407 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "SearchConfig.hpp"
+#include "SearchComponentLib.hpp"
+#include "ExPriorityQueue.hpp"
+#include "BeamSearchProcess.hpp"
+#include "Timer.hpp"
+
+namespace alib::Search::Lib {
+
+	/**
+	 * @brief IC[cA[̃r[T[`
+	 * @details cT؂pb`̓KpE߂̗ƂĎA[xƂɐ擪1񑖍
+	 * @note ؂̊Ǘ͐[xƂɖ؂̑傫ɔႵAQƃJEgJڗp̃X^bNȂ
+	 * @tparam Config
+	*/
+	template<class ConfigClass, class Space>
+	class EulerTourBeamSearchProcess {
+	public:
+		using Config = ConfigClass;
+		using SpaceType = Space;
+	private:
+		using ArgumentType = typename Config::ArgumentType;
+		using SearchMethod = typename Config::SearchMethod;
+		using PatchType = Memo::PatchType;
+		using IMemo = MemoSingleton<Space>;
+		static_assert(not Config::UseStateCopy(), "Config::UseStateCopy() is supported only by BeamSearchProcess");
+
+		/**
+		 * @brief T
+		*/
+		struct Candidate {
+			Candidate() = default;
+			Candidate(const size_type parent, const SearchMethod& arg) noexcept : parent(parent), searchArgument(arg) {}
+
+			/** @brief em[ȟ݂̐[xł̔ԍ */
+			size_type parent = 0;
+			/** @brief T */
+			SearchMethod searchArgument{};
+
+			NODISCARD bool operator<(const Candidate& o) const noexcept { return searchArgument.score < o.searchArgument.score; }
+			NODISCARD bool operator>(const Candidate& o) const noexcept { return o < *this; }
+		};
+
+		using Ranking = ExPriorityQueue<Candidate>;
+		/** @brief 擪ɎL[ */
+		using BoundedRanking = ExPriorityQueue<Candidate, typename Ranking::greater>;
+		using NextRanking = std::conditional_t<Config::UseBoundedRanking(), BoundedRanking, Ranking>;
+
+		/**
+		 * @brief cA[̑
+		*/
+		enum class TourType : unsigned char {
+			/** @brief pb`KĎqɍ~ */
+			Down,
+			/** @brief pb`߂Đeɏオ */
+			Up,
+			/** @brief tWJ */
+			Leaf,
+		};
+
+		/**
+		 * @brief cA[̗vf
+		*/
+		struct TourStep {
+			TourType type = TourType::Leaf;
+			/** @brief t̔ԍ */
+			size_type leaf = 0;
+			/** @brief ~Eオӂ̃pb` */
+			PatchType patch{};
+		};
+
+		/**
+		 * @brief ʂ̕pɎcWJς݃m[h
+		*/
+		struct History {
+			/** @brief em[h̔ԍ */
+			size_type parent = 0;
+			ArgumentType argument{};
+		};
+
+		/** @brief ݂̐[x̃cA[ */
+		std::vector<TourStep> tour;
+		/** @brief ̐[x̃cA[i쐬pj */
+		std::vector<TourStep> nextTour;
+		/** @brief cA[̑ʒu */
+		size_type cursor = 0;
+
+		/** @brief ݂̐[x̗t */
+		std::vector<Candidate> leaves;
+		/** @brief t̓WJō쐬pb` */
+		std::vector<PatchType> leafPatches;
+		/** @brief WJ̗t */
+		size_type currentLeaf = 0;
+		/** @brief WJ̗t */
+		bool hasCandidate = false;
+
+		/** @brief ̐[x̒TL[ */
+		NextRanking nextRanking;
+		/** @brief ̐[xœWJiem[h̏ɕׂj */
+		std::vector<Candidate> selected;
+
+		/** @brief WJς݃m[hi擪͉z̍j */
+		std::vector<History> history;
+		/** @brief ݂̐[x̗t̐擪̗ԍ */
+		size_type layerBase = 0;
+
+		/** @brief cT[x */
+		int remainDepth = narrow_cast<int>(Config::GetDepth());
+		/** @brief [x̒Tԁimsj */
+		double nextLimit = static_cast<double>(Config::GetLimit()) / Config::GetDepth();
+
+		/** @brief T^C}[ */
+		Timer timer;
+		/** @brief TԂ̕ύX̋L^iT bindMemo ŌĂяoXbhɃoChj */
+		Memo memo;
+
+		/** @brief ԑJڂœKppb` */
+		TransitionCounter transitionCounter;
+
+		NODISCARD double getNextLimit(const double interval) const noexcept {
+			return ((Config::GetLimit() - interval) / remainDepth) + interval;
+		}
+
+		void release(const PatchType& patch) {
+			if (patch.hasValue()) {
+				memo.release(patch);
+			}
+		}
+
+		/**
+		 * @brief ێĂSẴpb`
+		*/
+		void releasePatches() {
+			for (const auto& step : tour) {
+				if (step.type == TourType::Down) {
+					release(step.patch);
+				}
+			}
+			for (const auto& patch : leafPatches) {
+				release(patch);
+			}
+			tour.clear();
+			leafPatches.clear();
+		}
+
+		void clear() {
+			releasePatches();
+			leaves.clear();
+			nextRanking.clear();
+			selected.clear();
+			history.clear();
+		}
+
+		void destruction() {
+			// ʂ̕ɂ͗ƌ݂̂g
+			releasePatches();
+			cursor = 0;
+			memo.unlock();
+		}
+
+		/**
+		 * @brief c̃cA[tWJɑčɖ߂
+		*/
+		void skipTour() noexcept {
+			size_type nest = 0;
+			for (; cursor < tour.size(); cursor++) {
+				const auto& step = tour[cursor];
+				if (step.type == TourType::Down) {
+					nest++;
+				}
+				else if (step.type == TourType::Up) {
+					if (0 < nest) {
+						nest--;
+					}
+					else {
+						step.patch.undo();
+						transitionCounter.undo++;
+					}
+				}
+			}
+		}
+
+		/**
+		 * @brief ̐[xœWJIсAcA[蒼
+		*/
+		void rebuildTour() {
+			selected.clear();
+			if constexpr (Config::UseBoundedRanking()) {
+				selected.assign(nextRanking.begin(), nextRanking.end());
+			}
+			else {
+				while (selected.size() < Config::GetWidth() && not nextRanking.empty()) {
+					selected.push_back(nextRanking.top());
+					nextRanking.pop();
+				}
+			}
+			nextRanking.clear();
+
+			// em[h̏icA[̗t̏jɕׂ
+			std::sort(selected.begin(), selected.end(), [](const Candidate& a, const Candidate& b) {
+				if (a.parent != b.parent) {
+					return a.parent < b.parent;
+				}
+				return b < a;
+			});
+
+			const size_type nextBase = history.size();
+			for (const auto& item : selected) {
+				history.push_back(History{ layerBase + item.parent, item.searchArgument.argument });
+			}
+
+			nextTour.clear();
+			auto it = selected.begin();
+			for (const auto& step : tour) {
+				if (step.type == TourType::Down) {
+					nextTour.push_back(step);
+				}
+				else if (step.type == TourType::Up) {
+					if (not nextTour.empty() && nextTour.back().type == TourType::Down) {
+						// qɗtcȂӂ͍폜
+						release(step.patch);
+						nextTour.pop_back();
+					}
+					else {
+						nextTour.push_back(step);
+					}
+				}
+				else {
+					const auto& patch = leafPatches[step.leaf];
+					if (it == selected.end() || it->parent != step.leaf) {
+						release(patch);
+						continue;
+					}
+					if (patch.hasValue()) {
+						nextTour.push_back(TourStep{ TourType::Down, 0, patch });
+					}
+					for (; it != selected.end() && it->parent == step.leaf; ++it) {
+						nextTour.push_back(TourStep{ TourType::Leaf, narrow_cast<size_type>(it - selected.begin()), PatchType() });
+					}
+					if (patch.hasValue()) {
+						nextTour.push_back(TourStep{ TourType::Up, 0, patch });
+					}
+				}
+			}
+			assert(it == selected.end());
+
+			std::swap(tour, nextTour);
+			std::swap(leaves, selected);
+			leafPatches.assign(leaves.size(), PatchType());
+			layerBase = nextBase;
+			cursor = 0;
+		}
+	public:
+		/**
+		 * @brief ĂяoXbhɎgMemooCh
+		 * @details TԂ̌^̒Tsł悤ɁAT͎gMemoɋL^
+		 * @return jƌMemoɖ߂oCh
+		*/
+		NODISCARD typename IMemo::Binding bindMemo() noexcept {
+			return typename IMemo::Binding(memo);
+		}
+
+		void timerStart() noexcept {
+			timer.start();
+		}
+
+		void init() {
+			clear();
+			remainDepth = narrow_cast<decltype(remainDepth)>(Config::GetDepth());
+			const auto interval = timer.interval();
+			nextLimit = getNextLimit(interval);
+			transitionCounter = TransitionCounter();
+
+			// z̍WJς݂̗tƂĊJn
+			history.push_back(History{ 0, ArgumentType{} });
+			layerBase = 0;
+			tour.push_back(TourStep{ TourType::Leaf, 0, PatchType() });
+			cursor = tour.size();
+			leafPatches.assign(1, PatchType());
+			currentLeaf = 0;
+			hasCandidate = false;
+
+			memo.lock();
+		}
+
+		NODISCARD bool onloop() {
+			if (hasCandidate) {
+				// nbVvŃXLbvꂽꍇ
+				hasCandidate = false;
+			}
+			else {
+				// WJt̕ύXL^ĐȅԂɖ߂
+				const auto patch = memo.commit();
+				if (patch.hasValue()) {
+					patch.undo();
+					transitionCounter.undo++;
+				}
+				leafPatches[currentLeaf] = patch;
+			}
+
+			while (true) {
+				if (tour.size() <= cursor) {
+					const double interval = timer.interval();
+					if (remainDepth <= 0) {
+						destruction();
+						return false;
+					}
+					nextLimit = getNextLimit(interval);
+					remainDepth--;
+					rebuildTour();
+					if (tour.empty()) {
+						destruction();
+						return false;
+					}
+				}
+
+				const auto& step = tour[cursor];
+				cursor++;
+				if (step.type == TourType::Down) {
+					step.patch.redo();
+					transitionCounter.redo++;
+				}
+				else if (step.type == TourType::Up) {
+					step.patch.undo();
+					transitionCounter.undo++;
+				}
+				else if (nextLimit <= timer.interval()) {
+					// Ԑ؂̏ꍇ͎c̗tWJȂ
+					skipTour();
+				}
+				else {
+					currentLeaf = step.leaf;
+					hasCandidate = true;
+					return true;
+				}
+			}
+		}
+
+		void accept() {
+			assert(hasCandidate);
+			hasCandidate = false;
+		}
+
+		void reserve(const SearchMethod& argument) {
+			if constexpr (Config::UseBoundedRanking()) {
+				if (Config::GetWidth() <= nextRanking.size()) {
+					// ȉ̌͋L^Ɋp
+					if (not (nextRanking.top().searchArgument.score < argument.score)) {
+						return;
+					}
+					nextRanking.pop();
+				}
+			}
+			nextRanking.emplace(currentLeaf, argument);
+		}
+
+		NODISCARD const SearchMethod& getArgument() const noexcept {
+			assert(hasCandidate);
+			return leaves[currentLeaf].searchArgument;
+		}
+		NODISCARD bool endOfSearch() const noexcept {
+			return remainDepth == 0;
+		}
+		NODISCARD int getDepth() const noexcept {
+			return narrow_cast<int>(Config::GetDepth()) - remainDepth - 2;
+		}
+
+		/**
+		 * @brief ԑJڂœKppb`
+		 * @return pb`
+		*/
+		NODISCARD const TransitionCounter& getTransitionCounter() const noexcept {
+			return transitionCounter;
+		}
+
+		NODISCARD std::vector<ArgumentType> getResultList() const {
+			if (nextRanking.empty()) {
+				return std::vector<ArgumentType>();
+			}
+			else {
+				std::vector<ArgumentType> args(Config::GetDepth());
+				const auto& top = [&]() -> const Candidate& {
+					if constexpr (Config::UseBoundedRanking()) {
+						return *std::max_element(nextRanking.begin(), nextRanking.end());
+					}
+					else {
+						return nextRanking.top();
+					}
+				}();
+				args[Config::GetDepth() - 1] = top.searchArgument.argument;
+				size_type node = layerBase + top.parent;
+				forstep(depth, 1, Config::GetDepth()) {
+					if (history[node].parent == 0) {
+						break;
+					}
+					args[Config::GetDepth() - 1 - depth] = history[node].argument;
+					node = history[node].parent;
+				}
+				return args;
+			}
+		}
+	};
+}
@@ -110,6 +110,17 @@ namespace alib::Search::Lib {
 			c.pop_back();
 		}
 
+		/**
+		 * @brief vfւăq[vč\z
+		 * @param first 擪Ce[^
+		 * @param last I[Ce[^
+		*/
+		template <class Iter>
+		void assign(Iter first, Iter last) {
+			c.assign(first, last);
+			std::make_heap(c.begin(), c.end(), comp);
+		}
+
 		void reserve(const size_type n) { return c.reserve(n); }
 		void clear() noexcept { c.clear(); }
 
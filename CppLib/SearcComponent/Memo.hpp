@@ -2,6 +2,9 @@
 
 #include <memory>
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
 
 #include "SearchComponentLib.hpp"
 #include "Buffer.hpp"
@@ -21,7 +24,16 @@ namespace alib::Search::Lib {
 	private:
 		Buffer<16_K, MemoSizeType> buffer{};
 		PagingMemory<std::byte, 1_M> pool;
+		/** @brief L^łAhX͈̔́i擪0̏ꍇ͊mFȂj */
+		std::uintptr_t regionBegin = 0;
+		std::uintptr_t regionEnd = 0;
 
+		NODISCARD bool inRegion(const void* data, const size_type size) const noexcept {
+			WARN_PUSH_DISABLE(26490);
+			const auto address = reinterpret_cast<std::uintptr_t>(data);
+			WARN_POP();
+			return regionBegin == 0 || (regionBegin <= address && address + size <= regionEnd);
+		}
 	public:
 
 		Memo() = default;
@@ -34,12 +46,26 @@ namespace alib::Search::Lib {
 		void lock() noexcept { buffer.lock(); }
 		void unlock() noexcept { buffer.unlock(); }
 
+		/**
+		 * @brief L^łAhX͈̔͂ݒ肷
+		 * @details ͈͊O̕ύX̋L^̓AT[gŌoipb`ʂ̕ւ炵ēKpꍇɁA点ȂlL^ĂȂmFj
+		 * @param begin ͈͂̐擪
+		 * @param size ͈͂̃TCYibytej
+		*/
+		void setRegion(const void* begin, const size_type size) noexcept {
+			WARN_PUSH_DISABLE(26490);
+			regionBegin = reinterpret_cast<std::uintptr_t>(begin);
+			WARN_POP();
+			regionEnd = regionBegin + size;
+		}
+
 		/**
 		 * @brief w肳ꂽf[^L^
 		 * @param data f[^|C^
 		 * @param size f[^TCY
 		*/
 		void modify(void* data, const size_type size) noexcept {
+			assert(inRegion(data, size));
 			buffer.modify(data, size);
 		}
 
@@ -51,19 +77,21 @@ namespace alib::Search::Lib {
 		template<class Type>
 		void modify(Type& data) noexcept {
 			WARN_PUSH_DISABLE(26474);
-			buffer.modify(reinterpret_cast<void*>(std::addressof(data)), sizeof(Type));
+			modify(reinterpret_cast<void*>(std::addressof(data)), sizeof(Type));
 			WARN_POP();
 		}
 
 		/**
 		 * @brief pb`쐬
+		 * @details y[WɎ܂Ȃpb`͌ʂɊmۂ
+		 * @param shift L^AhX獷ibytej
 		 * @return pb`
 		*/
-		NODISCARD PatchType commit() {
+		NODISCARD PatchType commit(const std::ptrdiff_t shift = 0) {
 			const size_type wholeSize = buffer.wholeSize();
 			pointer first = pool.allocate(wholeSize);
 			const Stream buf(first, wholeSize);
-			return buffer.commit(buf);
+			return buffer.commit(buf, shift);
 		}
 		/**
 		 * @brief pb`f[^
@@ -72,38 +100,84 @@ namespace alib::Search::Lib {
 		void release(const PatchType& patch) {
 			pool.release(patch.address());
 		}
+		/**
+		 * @brief pb`f[^܂Ƃ߂ĉ
+		 * @param begin ɕׂpb`̃AhX̐擪Ce[^
+		 * @param end I[Ce[^
+		*/
+		template<class Iter>
+		void release(Iter begin, const Iter end) {
+			pool.release(begin, end);
+		}
 	};
 
 	template<class Space>
 	class MemoSingleton final {
 	private:
 		inline static Memo instance{};
+		/** @brief ĂяoXbhŎgp̃CX^X */
+		inline static thread_local Memo* active = std::addressof(instance);
 	public:
 
 		inline static Memo& Get() {
-			return instance;
+			return *active;
 		}
 
+		/**
+		 * @brief ĂяoXbhŎgpCX^X؂ւ
+		 * @details T͒TɎg̃CX^XoCh邽߁A^̒TʃXbhŕsł
+		 * @param memo gpCX^X
+		 * @return ؂ւÕCX^X
+		*/
+		inline static Memo* Bind(Memo& memo) noexcept {
+			return std::exchange(active, std::addressof(memo));
+		}
+		/**
+		 * @brief XR[v̊ԂĂяoXbhɃCX^XoCh
+		 * @details TOŔꍇAjCX^XoChꂽ܂܎cȂ悤Ɍɖ߂
+		*/
+		class Binding final {
+		private:
+			Memo* previous;
+		public:
+			explicit Binding(Memo& memo) noexcept : previous(Bind(memo)) {}
+			~Binding() {
+				active = previous;
+			}
+
+			Binding(const Binding&) = delete;
+			Binding(Binding&&) = delete;
+			Binding& operator=(const Binding&) = delete;
+			Binding& operator=(Binding&&) = delete;
+		};
+
 		/**
 		 * @brief w肳ꂽ|C^L^
+		 * @tparam StateCopy ԑŜ𕡐iL^Ȃj
 		 * @tparam Type f[^^
 		 * @param ptr f[^|C^
 		*/
-		template<typename Type>
+		template<bool StateCopy = false, typename Type>
 		inline static void Modify(Type& ptr) noexcept {
-			instance.modify(ptr);
+			if constexpr (not StateCopy) {
+				Get().modify(ptr);
+			}
 		}
 
 		/**
 		 * @brief w肳ꂽf[^L^
+		 * @tparam StateCopy ԑŜ𕡐iL^ɑj
 		 * @tparam Type f[^^
 		 * @param ptr f[^|C^
 		 * @param o ύXl
 		*/
-		template<typename Type>
+		template<bool StateCopy = false, typename Type>
 		inline static void Modify(Type& ptr, const Type& o) noexcept {
-			if (ptr != o) {
-				instance.modify(ptr);
+			if constexpr (StateCopy) {
+				ptr = o;
+			}
+			else if (ptr != o) {
+				Get().modify(ptr);
 				ptr = o;
 			}
 		}
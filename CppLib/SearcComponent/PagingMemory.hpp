@@ -31,6 +31,8 @@ namespace alib::Search::Lib {
 
 		std::stack<pointer> unusedMemory;
 		std::vector<MemoryData> memory;
+		/** @brief y[WɎ܂ȂmہiAhXAmۃTCYj */
+		std::vector<MemoryData> blocks;
 
 		pointer first = nullptr;
 		pointer last = nullptr;
@@ -61,6 +63,34 @@ namespace alib::Search::Lib {
 			return std::upper_bound(memory.begin(), memory.end(), MemoryData(p, 0));;
 		}
 
+		/**
+		 * @brief y[WɎ܂ȂmۂT
+		 * @param ptr mۂ|C^
+		 * @return Ȃꍇ͏I[
+		*/
+		NODISCARD std::vector<MemoryData>::iterator findBlock(const_pointer ptr) {
+			const uintptr_t p = toInteger(ptr);
+			const auto it = std::lower_bound(blocks.begin(), blocks.end(), MemoryData(p, 0));
+			return (it != blocks.end() && it->first == p) ? it : blocks.end();
+		}
+		/**
+		 * @brief y[WɎ܂Ȃmۂ
+		 * @param ptr mۂ|C^
+		 * @return ꍇtrue
+		*/
+		bool releaseBlock(const_pointer ptr) {
+			if (blocks.empty()) {
+				return false;
+			}
+			const auto it = findBlock(ptr);
+			if (it == blocks.end()) {
+				return false;
+			}
+			traits::deallocate(alloc, toPointer(it->first), it->second);
+			blocks.erase(it);
+			return true;
+		}
+
 		void deploy(pointer p) {
 			first = p;
 			last = p;
@@ -76,26 +106,48 @@ namespace alib::Search::Lib {
 
 	public:
 
-		PagingMemory() {
-			forange(t, 64) {
-				pointer p = traits::allocate(alloc, GetPagingCount());
-				memory.emplace_back(toInteger(p), 0);
-			}
-			std::sort(memory.begin(), memory.end());
-		}
+		/** @brief y[W͍ŏ̊mێɍ쐬 */
+		PagingMemory() = default;
+		PagingMemory(const PagingMemory&) = delete;
+		PagingMemory(PagingMemory&&) = default;
 		~PagingMemory() {
-			for (auto rit = memory.rbegin(), rend = memory.rbegin(); rit != rend; ++rit) {
+			for (auto rit = memory.rbegin(), rend = memory.rend(); rit != rend; ++rit) {
 				traits::deallocate(alloc, toPointer(rit->first), GetPagingCount());
 			}
+			for (const auto& block : blocks) {
+				traits::deallocate(alloc, toPointer(block.first), block.second);
+			}
+		}
+
+		PagingMemory& operator=(const PagingMemory&) = delete;
+		PagingMemory& operator=(PagingMemory&&) = delete;
+
+		/**
+		 * @brief 쐬ς݂̃y[W
+		*/
+		NODISCARD size_type pageCount() const noexcept {
+			return memory.size();
+		}
+		/**
+		 * @brief y[WɎ܂Ȃmۂ̂̐
+		*/
+		NODISCARD size_type blockCount() const noexcept {
+			return blocks.size();
 		}
 
 		/**
 		 * @brief w肳ꂽTCYmۂ
+		 * @details y[WɎ܂ȂTCY͌ʂɊmۂAɕԋp
 		 * @param size mۃTCY
 		 * @return mۂ|C^
 		*/
 		NODISCARD pointer allocate(const size_type size) {
-			assert(size <= GetPagingCount());
+			if (GetPagingCount() < size) {
+				pointer p = traits::allocate(alloc, size);
+				const MemoryData block(toInteger(p), size);
+				blocks.insert(std::upper_bound(blocks.begin(), blocks.end(), block), block);
+				return p;
+			}
 
 			if (first != nullptr) {
 				const size_type capacity = std::distance(last, reserved);
@@ -145,6 +197,9 @@ namespace alib::Search::Lib {
 		 * @param data
 		*/
 		void release(const_pointer data) {
+			if (releaseBlock(data)) {
+				return;
+			}
 			const auto it = findMemory(data);
 
 			assert(0 < it->second);
@@ -155,5 +210,35 @@ namespace alib::Search::Lib {
 				}
 			}
 		}
+
+		/**
+		 * @brief mۂ|C^܂Ƃ߂ĉ
+		 * @details y[W̃|C^̓y[W̌1ɂ܂Ƃ߂
+		 * @param begin ɕׂ|C^̐擪Ce[^
+		 * @param end I[Ce[^
+		*/
+		template<class Iter>
+		void release(Iter begin, const Iter end) {
+			while (begin != end) {
+				if (releaseBlock(*begin)) {
+					++begin;
+					continue;
+				}
+				const auto it = findMemory(*begin);
+				const uintptr_t pageEnd = it->first + GetPagingCount() * sizeof(value_type);
+
+				size_type count = 0;
+				for (; begin != end && toInteger(*begin) < pageEnd; ++begin) {
+					count++;
+				}
+				assert(count <= it->second);
+				it->second -= count;
+				if (it->second <= 0) {
+					if (it->first != toInteger(first)) {
+						unusedMemory.push(toPointer(it->first));
+					}
+				}
+			}
+		}
 	};
 }
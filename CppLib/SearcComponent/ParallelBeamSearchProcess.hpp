@@ -0,0 +1,456 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <thread>
+#include <vector>
+
+#include "SearchConfig.hpp"
+#include "SearchComponentLib.hpp"
+#include "SearchNode.hpp"
+#include "ExPriorityQueue.hpp"
+#include "VisitedSet.hpp"
+#include "Timer.hpp"
+
+namespace alib::Search::Lib {
+
+	/**
+	 * @brief r[T[`i1[J[j
+	 * @details e[J[͒TԂ̕ƐpMemoA[xƂɌW񂵂čĕzB
+	 * m[h͐擪[J[̃m[hǗőS[J[̒~ɍ쐬EAT͊e[J[QƂ̂ݍs
+	 * @tparam Config
+	 * @tparam Space T
+	*/
+	template<class ConfigClass, class Space>
+	class ParallelBeamSearchProcess {
+	public:
+		using Config = ConfigClass;
+		using SpaceType = Space;
+	private:
+		using ArgumentType = typename Config::ArgumentType;
+		using SearchMethod = typename Config::SearchMethod;
+		using NodePool = CompactNodePool<ArgumentType>;
+		using NodeIndex = typename NodePool::index_type;
+		using Candidate = SearchCandidate<Config, NodeIndex>;
+		using Ranking = ExPriorityQueue<Candidate>;
+		using IMemo = MemoSingleton<Space>;
+		static_assert(not Config::UseStateCopy(), "Config::UseStateCopy() is supported only by BeamSearchProcess");
+
+		/**
+		 * @brief zꂽTm[h
+		*/
+		struct AssignedNode {
+			/** @brief 쐬ς݂̃m[h̔ԍ */
+			NodeIndex node = 0;
+			/** @brief T */
+			SearchMethod searchArgument{};
+		};
+
+		/** @brief [J[ԍ */
+		int owner = 0;
+		/** @brief 擪[J[̒TԂ̂ibytej */
+		std::ptrdiff_t shift = 0;
+
+		/** @brief [J[p̍L^ */
+		Memo memo;
+		/** @brief m[h̃pb`iS[J[̒~ɂ܂Ƃ߂ĉj */
+		std::vector<Memo::pointer> deadPatches;
+		/** @brief S[J[ŋLm[hǗi擪[J[ nodePoolj */
+		NodePool* sharedPool = nullptr;
+		/** @brief ԑJڂœKppb`̈ꎞ̈ */
+		std::array<Memo::PatchType, Config::GetDepth()> redos{};
+
+		/** @brief ݂̒Tm[h */
+		NodeIndex currentNode = 0;
+		/** @brief ݂̒Tm[h̃pb`쐬 */
+		bool uncommitted = false;
+
+		/** @brief STm[h */
+		std::vector<AssignedNode> assigned;
+		/** @brief ɏSm[hĩm[h̎j */
+		size_type cursor = 0;
+		/** @brief ̒Tiem[h̎QƂj */
+		std::vector<Candidate> candidates;
+		/** @brief [x̐؂ւɉm[h */
+		std::vector<NodeIndex> garbage;
+
+		/** @brief m[hǗi擪[J[̂ݎgpj */
+		NodePool nodePool;
+		/** @brief m[h̃pb`L^[J[ԍi擪[J[̂ݎgpAzɌ߂j */
+		std::vector<int> patchOwners;
+		/** @brief S[J[̌i擪[J[̂ݎgpj */
+		Ranking ranking;
+		/** @brief ̐[xɑI񂾌i擪[J[̂ݎgpj */
+		std::vector<Candidate> selected;
+		/** @brief [J[Ƃ̕zi擪[J[̂ݎgpj */
+		std::vector<size_type> loads;
+		/** @brief Tς݃nbVi擪[J[̂ݎgpj */
+		VisitedSet* layerVisited = nullptr;
+		/** @brief Tʁi擪[J[̂ݎgpj */
+		std::vector<ArgumentType> result;
+
+		/** @brief cT[x */
+		int remainDepth = narrow_cast<int>(Config::GetDepth());
+		/** @brief [x̒Tԁimsj */
+		double nextLimit = 0;
+
+		/** @brief T^C}[ */
+		Timer timer;
+		/** @brief LT^C}[ */
+		const Timer* sharedTimer = nullptr;
+
+		/**
+		 * @brief ԑJ
+		 * @details pb`͐擪[J[̃AhXŋL^Ă邽߁Ag̒TԂւ炵ēKp
+		 * @param current Jڌ
+		 * @param next Jڐ
+		*/
+		void transitin(const NodeIndex current, const NodeIndex next) noexcept {
+			const auto& pool = *sharedPool;
+			assert(next != 0);
+			assert(pool.node(next).parent != 0);
+			assert(!pool.node(next).hasPatch());
+
+			const auto path = CollectTransition(pool, current, pool.node(next).parent, redos, [this](const Memo::PatchType& patch) noexcept {
+				patch.undo(shift);
+			});
+			ApplyRedos(redos, path.first, shift);
+		}
+
+		/**
+		 * @brief m[h̎QƂOAQƂȂc܂ł
+		 * @details pb`͋L^[J[֕ԋp邽߁AS[J[̒~ɐ擪[J[ŌĂяo
+		 * @param workers S[J[
+		 * @param index m[h̔ԍ
+		*/
+		void release(const std::vector<ParallelBeamSearchProcess*>& workers, const NodeIndex index) {
+			ReleaseNode(nodePool, index, [&](const NodeIndex released, const CompactSearchNode& node) {
+				if (node.hasPatch()) { workers[patchOwners[released]]->deadPatches.push_back(node.patchData); }
+			});
+		}
+
+		/**
+		 * @brief [x̐؂ւɕsvȃm[h
+		 * @param workers S[J[
+		*/
+		void collect(const std::vector<ParallelBeamSearchProcess*>& workers) {
+			for (auto worker : workers) {
+				for (const auto node : worker->garbage) {
+					release(workers, node);
+				}
+				worker->garbage.clear();
+			}
+		}
+
+		/**
+		 * @brief m[h̃pb`e[J[ł܂Ƃ߂ĉ
+		 * @param workers S[J[
+		*/
+		static void Reclaim(const std::vector<ParallelBeamSearchProcess*>& workers) {
+			for (auto worker : workers) {
+				auto& patches = worker->deadPatches;
+				if (patches.empty()) {
+					continue;
+				}
+				std::sort(patches.begin(), patches.end());
+				worker->memo.release(patches.begin(), patches.end());
+				patches.clear();
+			}
+		}
+
+		/**
+		 * @brief ̃m[h쐬
+		 * @details ₪Ăem[h̎QƂ͍쐬m[hɈڂ
+		 * @param workers S[J[
+		 * @param item 
+		 * @param worker 郏[J[ԍ
+		 * @return m[h̔ԍ
+		*/
+		NODISCARD NodeIndex createNode(const std::vector<ParallelBeamSearchProcess*>& workers, const Candidate& item, const size_type worker) {
+			const NodeIndex index = nodePool.create(item.parent, item.searchArgument.argument);
+			release(workers, item.parent);
+			if (patchOwners.size() <= index) {
+				patchOwners.resize(static_cast<size_type>(index) + 1);
+			}
+			patchOwners[index] = narrow_cast<int>(worker);
+			return index;
+		}
+
+		/**
+		 * @brief ܂ł̈
+		 * @param item 
+		 * @return iԂ̌̏ꍇ͋j
+		*/
+		NODISCARD std::vector<ArgumentType> makePath(const Candidate& item) const {
+			std::vector<ArgumentType> path;
+			// Ԃ̃m[h̐e͒TJnÕm[h
+			if (nodePool.node(item.parent).parent == 0) {
+				return path;
+			}
+			path.reserve(nodePool.node(item.parent).depth);
+			path.push_back(item.searchArgument.argument);
+			for (NodeIndex node = item.parent; nodePool.node(nodePool.node(node).parent).parent != 0; node = nodePool.node(node).parent) {
+				path.push_back(nodePool.argument(node));
+			}
+			std::reverse(path.begin(), path.end());
+			return path;
+		}
+
+		NODISCARD double getNextLimit(const double interval) const noexcept {
+			return ((Config::GetLimit() - interval) / remainDepth) + interval;
+		}
+	public:
+		ParallelBeamSearchProcess() = default;
+		ParallelBeamSearchProcess(const ParallelBeamSearchProcess&) = delete;
+		ParallelBeamSearchProcess& operator=(const ParallelBeamSearchProcess&) = delete;
+
+		/**
+		 * @brief TɎgpXbh
+		 * @return Xbh
+		*/
+		NODISCARD static size_type GetThreads() noexcept {
+			if constexpr (Config::GetThreads() != 0) {
+				return Config::GetThreads();
+			}
+			else {
+				return std::max<size_type>(1, std::thread::hardware_concurrency());
+			}
+		}
+
+		/**
+		 * @brief zIԎɃnbV̏d
+		 * @details ͐[xƂɐ擪[J[ŏW񂷂邽߁AT[vł͔肵Ȃ
+		*/
+		NODISCARD static constexpr bool UseLayerFilter() noexcept {
+			return Config::HasHash();
+		}
+		/**
+		 * @brief IԎɎgTς݃nbVݒ肷
+		 * @param visited Tς݃nbV
+		*/
+		void setLayerFilter(VisitedSet& visited) noexcept {
+			layerVisited = std::addressof(visited);
+		}
+
+		void timerStart() noexcept {
+			timer.start();
+		}
+
+		/**
+		 * @brief T̏
+		 * @param workers S[J[i擪gj
+		 * @param spaces e[J[̒T
+		*/
+		void init(const std::vector<ParallelBeamSearchProcess*>& workers, const std::vector<const Space*>& spaces) {
+			assert(workers.size() == spaces.size());
+			assert(workers.front() == this);
+
+			remainDepth = narrow_cast<decltype(remainDepth)>(Config::GetDepth());
+			result.clear();
+			ranking.clear();
+
+			const NodeIndex root = nodePool.create();
+			if (patchOwners.size() <= root) {
+				patchOwners.resize(static_cast<size_type>(root) + 1);
+			}
+			patchOwners[root] = 0;
+			forange(idx, workers.size()) {
+				auto worker = workers[idx];
+				worker->owner = narrow_cast<int>(idx);
+				WARN_PUSH_DISABLE(26490);
+				worker->shift = reinterpret_cast<const std::byte*>(spaces[idx]) - reinterpret_cast<const std::byte*>(spaces.front());
+				WARN_POP();
+				// pb`͒TԂ̓̒l݂̂炵ēKpł
+				worker->memo.setRegion(spaces[idx], sizeof(Space));
+				worker->sharedPool = std::addressof(nodePool);
+				worker->sharedTimer = std::addressof(timer);
+
+				if (0 < idx) { nodePool.node(root).addRef(); }
+				worker->currentNode = root;
+				worker->uncommitted = false;
+				worker->assigned.clear();
+				worker->cursor = 0;
+				worker->candidates.clear();
+				worker->garbage.clear();
+
+				worker->memo.lock();
+			}
+		}
+
+		/**
+		 * @brief S[J[̌₩玟̐[x̒Tm[hIсAe[J[֕z
+		 * @details em[h[J[֗D悵ĕzÃ[J[L^pb`炵ēKpJڂ炷
+		 * i΂ꍇ1[J[̏𒴂𑼂̃[J[֕zj
+		 * @param workers S[J[i擪gj
+		 * @return Tm[h݂ꍇtrue
+		*/
+		NODISCARD bool distribute(const std::vector<ParallelBeamSearchProcess*>& workers) {
+			assert(workers.front() == this);
+
+			collect(workers);
+			if (remainDepth <= 0) {
+				Reclaim(workers);
+				return false;
+			}
+
+			for (auto worker : workers) {
+				for (const auto& item : worker->candidates) {
+					ranking.push(item);
+				}
+				worker->candidates.clear();
+			}
+
+			while (not ranking.empty() && selected.size() < Config::GetWidth()) {
+				const Candidate item = ranking.top();
+				ranking.pop();
+				if constexpr (UseLayerFilter()) {
+					if (not layerVisited->insert(item.searchArgument.hash)) {
+						release(workers, item.parent);
+						continue;
+					}
+				}
+				selected.push_back(item);
+			}
+			for (const auto& item : ranking) {
+				release(workers, item.parent);
+			}
+			ranking.clear();
+
+			const size_type quota = (selected.size() + workers.size() - 1) / workers.size();
+			loads.assign(workers.size(), 0);
+			size_type spare = 0;
+			for (const auto& item : selected) {
+				size_type worker = static_cast<size_type>(patchOwners[item.parent]);
+				if (quota <= loads[worker]) {
+					while (quota <= loads[spare]) {
+						spare++;
+					}
+					worker = spare;
+				}
+				loads[worker]++;
+				workers[worker]->assigned.push_back({ createNode(workers, item, worker), item.searchArgument });
+			}
+			const bool found = not selected.empty();
+			selected.clear();
+			Reclaim(workers);
+
+			const double limit = getNextLimit(timer.interval());
+			remainDepth--;
+			for (auto worker : workers) {
+				worker->remainDepth = remainDepth;
+				worker->nextLimit = limit;
+				worker->cursor = 0;
+			}
+
+			return found;
+		}
+
+		/**
+		 * @brief TIAŗǂ̌܂ł̈ʂƂĎc
+		 * @param workers S[J[i擪gj
+		*/
+		void finish(const std::vector<ParallelBeamSearchProcess*>& workers) {
+			assert(workers.front() == this);
+
+			collect(workers);
+
+			const Candidate* best = nullptr;
+			for (auto worker : workers) {
+				for (const auto& item : worker->candidates) {
+					if (best == nullptr || best->searchArgument.score < item.searchArgument.score) {
+						best = std::addressof(item);
+					}
+				}
+			}
+			if (best != nullptr) {
+				result = makePath(*best);
+			}
+
+			for (auto worker : workers) {
+				for (const auto& item : worker->candidates) {
+					release(workers, item.parent);
+				}
+				worker->candidates.clear();
+			}
+
+			// ̒Tŕł悤A擪[J[̒TԂԂ֖߂
+			for (NodeIndex node = currentNode; node != 0; node = nodePool.node(node).parent) {
+				if (nodePool.node(node).hasPatch()) {
+					nodePool.node(node).patch().undo(shift);
+				}
+			}
+			for (auto worker : workers) {
+				for (const auto& item : worker->assigned) {
+					release(workers, item.node);
+				}
+				worker->assigned.clear();
+				release(workers, worker->currentNode);
+				worker->currentNode = 0;
+				worker->memo.unlock();
+			}
+			Reclaim(workers);
+		}
+
+		/**
+		 * @brief ĂяoXbhŃ[J[pMemogp
+		 * @return jƌMemoɖ߂oCh
+		*/
+		NODISCARD typename IMemo::Binding bindMemo() noexcept {
+			return typename IMemo::Binding(memo);
+		}
+
+		NODISCARD bool onloop() {
+			if (uncommitted) {
+				// g̒Tm[ĥݏ邽߁Ã[J[ƓȂ
+				sharedPool->node(currentNode).setPatch(memo.commit(shift));
+				uncommitted = false;
+			}
+
+			if (assigned.size() <= cursor) {
+				assigned.clear();
+				return false;
+			}
+			// e[J[͎Ԑ؂łŒ1m[h͏
+			if (0 < cursor && nextLimit <= sharedTimer->interval()) {
+				forstep(idx, cursor, assigned.size()) {
+					garbage.push_back(assigned[idx].node);
+				}
+				assigned.clear();
+				return false;
+			}
+
+			cursor++;
+			return true;
+		}
+
+		void accept() {
+			assert(0 < cursor && cursor <= assigned.size());
+			const NodeIndex nextNode = assigned[cursor - 1].node;
+			transitin(currentNode, nextNode);
+			garbage.push_back(currentNode);
+			currentNode = nextNode;
+			uncommitted = true;
+		}
+
+		void reserve(const SearchMethod& argument) {
+			// em[h͎g̒Tm[ĥ߁AQƃJEg͑̃[J[ƋȂ
+			sharedPool->node(currentNode).addRef();
+			candidates.emplace_back(currentNode, argument);
+		}
+
+		NODISCARD const SearchMethod& getArgument() const noexcept {
+			assert(0 < cursor && cursor <= assigned.size());
+			return assigned[cursor - 1].searchArgument;
+		}
+		NODISCARD bool endOfSearch() const noexcept {
+			return remainDepth == 0;
+		}
+		NODISCARD int getDepth() const noexcept {
+			return narrow_cast<int>(Config::GetDepth()) - remainDepth - 2;
+		}
+
+		NODISCARD std::vector<ArgumentType> getResultList() const {
+			return result;
+		}
+	};
+}
@@ -1,9 +1,18 @@
 #pragma once
 
+#include <cstdint>
+#include <limits>
+
 #include "Stream.hpp"
 
 namespace alib::Search::Lib {
 
+	/**
+	 * @brief pb`
+	 * @details 擪̋L^̓AhXAȍ~̋L^͐擪̋L^̃AhX32bit̂
+	 * iꂪ܂Ȃꍇ FarOffset ɑăAhXj
+	 * @tparam MemoSize L^TCY̌^
+	*/
 	template<typename MemoSize>
 	class Patch {
 	public:
@@ -11,36 +20,68 @@ namespace alib::Search::Lib {
 		using pointer = Stream::pointer;
 
 		using MemoSizeType = MemoSize;
+		/** @brief 擪̋L^̃AhX̂ibytej */
+		using OffsetType = std::int32_t;
+		/** @brief ̑ɃAhXL^̈ */
+		static constexpr OffsetType FarOffset = std::numeric_limits<OffsetType>::min();
 	private:
 		pointer first = nullptr;
 		pointer last = nullptr;
+
+		/**
+		 * @brief L^̑ΏۃAhXǂݏo
+		 * @param stream L^̐擪̃Xg[
+		 * @param base 擪̋L^̃AhXi擪̋L^ǂݏoꍇnullptrj
+		 * @param shift L^ꂽAhXɉ邸ibytej
+		*/
+		NODISCARD inline static void* ReadAddress(Stream& stream, void*& base, const std::ptrdiff_t shift) noexcept {
+			if (base == nullptr) {
+				base = ShiftPointer(stream.get<void*>(), shift);
+				return base;
+			}
+			const auto offset = stream.get<OffsetType>();
+			if (offset == FarOffset) {
+				return ShiftPointer(stream.get<void*>(), shift);
+			}
+			return ShiftPointer(base, offset);
+		}
 	public:
 		Patch() = default;
 		Patch(pointer first, pointer last) noexcept : first(first), last(last) {}
 
 		NODISCARD inline bool hasValue() const noexcept { return first != last; }
 		NODISCARD inline pointer address() const noexcept { return first; }
+		/** @brief f[^̃TCYibytej */
+		NODISCARD inline size_type size() const noexcept { return static_cast<size_type>(last - first); }
 
-		/** @brief ߂ */
-		inline void undo() const noexcept {
+		/**
+		 * @brief ߂
+		 * @param shift L^ꂽAhXɉ邸ibytej
+		*/
+		inline void undo(const std::ptrdiff_t shift = 0) const noexcept {
 			assert(first != nullptr);
 
 			Stream stream(first, last);
+			void* base = nullptr;
 			while (stream.hasStream()) {
-				const auto ptr = stream.get<void*>();
+				const auto ptr = ReadAddress(stream, base, shift);
 				const auto size = stream.get<MemoSizeType>();
 				stream.seek(size);
 				stream.write(ptr, size);
 			}
 			assert(stream.endOfStream());
 		}
-		/** @brief K */
-		inline void redo() const noexcept {
+		/**
+		 * @brief K
+		 * @param shift L^ꂽAhXɉ邸ibytej
+		*/
+		inline void redo(const std::ptrdiff_t shift = 0) const noexcept {
 			assert(first != nullptr);
 
 			Stream stream(first, last);
+			void* base = nullptr;
 			while (stream.hasStream()) {
-				const auto ptr = stream.get<void*>();
+				const auto ptr = ReadAddress(stream, base, shift);
 				const auto size = stream.get<MemoSizeType>();
 				stream.write(ptr, size);
 				stream.seek(size);
@@ -3,6 +3,7 @@
 #include <array>
 #include <iterator>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 #include "Memo.hpp"
@@ -10,7 +11,7 @@
 namespace alib::Search {
 	namespace Lib {
 
-		template<typename Type, class Space>
+		template<typename Type, class Space, bool StateCopy = false>
 		class Reference {
 		public:
 			using value_type = Type;
@@ -36,17 +37,17 @@ namespace alib::Search {
 			Reference& operator=(Reference&&) = delete;
 
 			value_type operator=(const value_type value) {
-				IMemo::Modify(*ptr, value);
+				IMemo::template Modify<StateCopy>(*ptr, value);
 				return value;
 			}
 			NODISCARD operator value_type() const noexcept { return *ptr; }
 
-			void store(const value_type value) noexcept { IMemo::Modify(*ptr, value); }
+			void store(const value_type value) noexcept { IMemo::template Modify<StateCopy>(*ptr, value); }
 			NODISCARD value_type load() const noexcept { return *ptr; }
 		};
 
 
-		template<typename Type, class Space>
+		template<typename Type, class Space, bool StateCopy = false>
 		class Value {
 		public:
 			using value_type = Type;
@@ -68,12 +69,12 @@ namespace alib::Search {
 			explicit Value(const value_type v) noexcept : val(v) {}
 
 			value_type operator=(const value_type value) {
-				IMemo::Modify(val, value);
+				IMemo::template Modify<StateCopy>(val, value);
 				return value;
 			}
 			NODISCARD operator value_type() const noexcept { return val; }
 
-			void store(const value_type value) noexcept { IMemo::Modify(val, value); }
+			void store(const value_type value) noexcept { IMemo::template Modify<StateCopy>(val, value); }
 			NODISCARD value_type load() const noexcept { return val; }
 		};
 
@@ -92,7 +93,7 @@ namespace alib::Search {
 			static constexpr bool value = decltype(check<T>(nullptr))::value;
 		};
 
-		template<typename Type, size_type Size, class Space>
+		template<typename Type, size_type Size, class Space, bool StateCopy = false>
 		class Vector {
 		public:
 			using value_type = Type;
@@ -105,7 +106,7 @@ namespace alib::Search {
 
 		private:
 			using IMemo = MemoSingleton<Space>;
-			Value<size_type, Space> count{};
+			Value<size_type, Space, StateCopy> count{};
 			container_type c{};
 
 			bool hasCapacity(const size_type n) const noexcept {
@@ -292,14 +293,37 @@ namespace alib::Search {
 			}
 		};
 
+
+		/**
+		 * @brief ݒ肪ԑŜ𕡐邩
+		 * @tparam Config ݒivoid̏ꍇ͍L^j
+		*/
+		template<class Config>
+		NODISCARD constexpr bool IsStateCopyConfig() noexcept {
+			if constexpr (std::is_void_v<Config>) {
+				return false;
+			}
+			else {
+				return Config::UseStateCopy();
+			}
+		}
 	}
-	template<class Class>
+
+	/**
+	 * @brief TԂ̕ϐ̌^
+	 * @details L^@͒TԂ̌^琄肹AConfigŖ
+	 * @tparam Class T
+	 * @tparam Config T̐ݒiConfig::UseStateCopy() ̏ꍇ͍L^ɑj
+	*/
+	template<class Class, class Config = void>
 	struct MemoType {
+		static constexpr bool StateCopy = Lib::IsStateCopyConfig<Config>();
+
 		template<typename Type>
-		using Value = Lib::Value<Type, Class>;
+		using Value = Lib::Value<Type, Class, StateCopy>;
 		template<typename Type, size_type Size>
 		using Array = std::array<Type, Size>;
 		template<typename Type, size_type Size>
-		using Vector = Lib::Vector<Type, Size, Class>;
+		using Vector = Lib::Vector<Type, Size, Class, StateCopy>;
 	};
 }
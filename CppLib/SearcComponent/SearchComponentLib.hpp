@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <cstring>
+
 #include "../Basic.hpp"
 
 namespace alib::Search {
@@ -12,5 +15,35 @@ namespace alib::Search {
 		NODISCARD constexpr size_type operator"" _M(unsigned long long m) noexcept {
 			return m << 20;
 		}
+
+		/**
+		 * @brief |C^bytePʂł炷
+		 * @param ptr Ώۃ|C^
+		 * @param shift 炷ʁibytej
+		 * @return 炵|C^
+		*/
+		NODISCARD inline void* ShiftPointer(void* ptr, const std::ptrdiff_t shift) noexcept {
+			WARN_PUSH_DISABLE(26481 26490);
+			return reinterpret_cast<std::byte*>(ptr) + shift;
+			WARN_POP();
+		}
+
+		/**
+		 * @brief wTCYRs[
+		 * @details L^l̑傫i1, 2, 4, 8, 16 bytej͌Œ蒷̃Rs[ɓWJAȊO͎s̃TCYŃRs[
+		 * @param dst Rs[
+		 * @param src Rs[
+		 * @param size TCYibytej
+		*/
+		inline void CopyBytes(void* dst, const void* src, const size_type size) noexcept {
+			switch (size) {
+			case 1: std::memcpy(dst, src, 1); break;
+			case 2: std::memcpy(dst, src, 2); break;
+			case 4: std::memcpy(dst, src, 4); break;
+			case 8: std::memcpy(dst, src, 8); break;
+			case 16: std::memcpy(dst, src, 16); break;
+			default: std::memcpy(dst, src, size); break;
+			}
+		}
 	}
 }
@@ -3,6 +3,7 @@
 #include <utility>
 
 #include "SearchComponentLib.hpp"
+#include "TimeSchedule.hpp"
 
 namespace alib::Search {
 
@@ -40,6 +41,30 @@ namespace alib::Search {
 		DefaultSearchMethod(const ScoreType score, Args&& ...args) noexcept : score(score), argument(ArgumentType(std::forward<Args>(args)...)) {}
 	};
 
+	/**
+	 * @brief nbVɂd͈̔
+	*/
+	enum class DedupeScope {
+		/** @brief WJɒTς݂̃nbV̂ݏ */
+		Expand,
+		/** @brief \񎞂ɓ[x̌ƔrAXRA̍c */
+		Depth,
+		/** @brief \񎞂ɓ[x̌ƔrAO̐[xŗ\񂳂ꂽnbV͏ */
+		Global,
+	};
+
+	/**
+	 * @brief sɎw肷Tp[^
+	*/
+	struct SearchParameters {
+		/** @brief T[x */
+		size_type depth = 0;
+		/** @brief r[ */
+		size_type width = 0;
+		/** @brief Tԁimsj */
+		size_type limit = 0;
+	};
+
 	template <size_type Depth, size_type Width, size_type Limit, class Method, bool Debug = false>
 	struct ConfigTemplate {
 		using SearchMethod = Method;
@@ -55,5 +80,107 @@ namespace alib::Search {
 		NODISCARD inline static constexpr size_type GetDepth() noexcept { return Depth; }
 		NODISCARD inline static constexpr size_type GetWidth() noexcept { return Width; }
 		NODISCARD inline static constexpr size_type GetLimit() noexcept { return Limit; }
+
+		/**
+		 * @brief T[xEr[ETԂsɎw肷
+		 * @details ev[g͊lɂȂATƂ setParameters ŕύXłȉꍇ͒萔ƂēWJj
+		 * @note BeamSearchProcesŝݑΉBL̏ꍇ GetDepthWidth() g킸S[xœr[ɂȂ
+		*/
+		NODISCARD inline static constexpr bool UseRuntimeParameters() noexcept { return false; }
+
+		/**
+		 * @brief [xƂɓWJm[h
+		 * @details [xƂɃr[ςꍇ͔hNXōĒ`iconstexpr̔z̎QƂ[x̊֐ɂłj
+		 * @param depth WJ[xisearchł getDepth() ̒lŁAő GetDepth() - 1j
+		 * @note BeamSearchProcesŝݑΉBUseBoundedRanking() ̏ꍇ͗\񎞂̌␔̏ɂg
+		*/
+		NODISCARD inline static constexpr size_type GetDepthWidth(const size_type) noexcept { return Width; }
+
+		/**
+		 * @brief [x̒ߐ؂𒴂Ă悢ԁimsj
+		 * @details ߐ؂̔Ŏ̓ǂݏo̎ԂɎ܂͈͂ŊԈi0̏ꍇ͖ǂݏoj
+		 * @note BeamSearchProcessChokudaiSearchProcessΉ
+		*/
+		NODISCARD inline static constexpr double GetTimeTolerance() noexcept { return 0.1; }
+
+		/**
+		 * @brief [xƂ̎Ԕz
+		 * @note ύXꍇ͔hNX Lib::AdaptiveTimeSchedule<> ȂǂɍĒ`iBeamSearchProcesŝݑΉj
+		*/
+		using TimeSchedule = Lib::EvenTimeSchedule;
+
+		/**
+		 * @brief Ԃ̕i`FbN|Cgjۑ[x̊Ԋui0̏ꍇ͐[xł͕ۑȂj
+		 * @details ԑJڂœKppb`ꍇ́AJڐɋ߂`FbN|Cg畜Ďc̃pb`̂ݓKp
+		 * @note BeamSearchProcesŝݑΉATԂ setSearchState ɂԂ̗̈o^ꍇ̂ݗL
+		*/
+		NODISCARD inline static constexpr size_type GetCheckpointInterval() noexcept { return 0; }
+		/**
+		 * @brief `FbN|Cg̃pb`̍vTCYibytej̒lȏɂȂm[hŕۑi0̏ꍇ̓TCYł͕ۑȂj
+		 * @note BeamSearchProcesŝݑΉ
+		*/
+		NODISCARD inline static constexpr size_type GetCheckpointBytes() noexcept { return 0; }
+
+		/**
+		 * @brief ԑŜm[hƂɕA̋L^ƏԑJڂ̃pb`KpsȂ
+		 * @details Ԃł͒lƂ̍̋L^Ŝ̕̕
+		 * @note BeamSearchProcesŝݑΉBTԂ MemoType<Space, Config> ŕϐ錾i݂L^ɑjA
+		 * setSearchState ɂԂ̗̈o^邱Ɓio^̏ꍇ start  std::logic_error 𑗏oj
+		*/
+		NODISCARD inline static constexpr bool UseStateCopy() noexcept { return false; }
+
+		/**
+		 * @brief Tς݃nbV̏e
+		 * @note ꍇ͊g
+		*/
+		NODISCARD inline static constexpr size_type GetVisitedCapacity() noexcept { return Depth * Width; }
+
+		/**
+		 * @brief nbVɂd͈̔
+		 * @note BeamSearchProcesŝݑΉAnbVȂꍇ͖
+		*/
+		NODISCARD inline static constexpr DedupeScope GetDedupeScope() noexcept { return DedupeScope::Expand; }
+
+		/**
+		 * @brief [xƂɓoPbgWJm[h̏i0̏ꍇ͖j
+		 * @details ԂɃr[Ŵh
+		 * @note BeamSearchProcesŝݑΉBUseBoundedRanking() ̏ꍇ͗\񎞂ɎcWidth̒œKp
+		*/
+		NODISCARD inline static constexpr size_type GetBucketCapacity() noexcept { return 0; }
+		/** @brief oPbgioPbg̃L[͂̐Ŋ]gj */
+		NODISCARD inline static constexpr size_type GetBucketCount() noexcept { return 1024; }
+		/**
+		 * @brief T̃oPbg̃L[
+		 * @note ̓nbVlŁAeL[ɂꍇ͔hNXōĒ`
+		*/
+		template<class SearchMethod>
+		NODISCARD inline static constexpr size_type GetBucket(const SearchMethod& method) noexcept { return static_cast<size_type>(method.hash); }
+
+		/**
+		 * @brief T̃Xbhi0̏ꍇ̓n[hEFA̕񐔁j
+		 * @note ύXꍇ͔hNXōĒ`
+		*/
+		NODISCARD inline static constexpr size_type GetThreads() noexcept { return 0; }
+
+		/**
+		 * @brief ̐[x̌Widthɐ
+		 * @details ȉ̌̓m[hmۂɊp
+		 * @note nbVvŃXLbvꂽ͕[Ȃ߁A[x̒TWidth邱Ƃ
+		*/
+		NODISCARD inline static constexpr bool UseBoundedRanking() noexcept { return false; }
+
+		/**
+		 * @brief [xƂɓWJm[hIłAem[h̓WJi؂DFSjɕׂēWJ
+		 * @details AԑJڂZԂ̈ړɂȂApb`̓Kp񐔂
+		 * @note Ԑ؂̏ꍇ̓XRAł͂ȂWJőł؂BnbV̏d͓WJm[hIԎɏA_̌Ŗ߂
+		*/
+		NODISCARD inline static constexpr bool UseGroupedExpansion() noexcept { return false; }
+
+		/**
+		 * @brief chokudaiT[`̐[xƂ̒Tm[hL[Ɏc␔
+		 * @details ␔̒l2{ɒBʂ̂ݎcAc͐em[h̎QƂOĎ̂Ă
+		 * @note ChokudaiSearchProcesŝݑΉ
+		*/
+		NODISCARD inline static constexpr size_type GetQueueCapacity() noexcept { return Width * 16; }
 	};
 }
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "SearchComponentLib.hpp"
+
+namespace alib::Search {
+
+	/**
+	 * @brief T̍ŗǂ̌
+	 * @tparam Config
+	*/
+	template<class Config>
+	struct SearchResult {
+		using ArgumentType = typename Config::ArgumentType;
+		using ScoreType = typename Config::ScoreType;
+
+		/** @brief ŗǂ̌܂ł̈ȉꍇ͓r܂Łj */
+		std::vector<ArgumentType> args{};
+		/** @brief ŗǂ̌̃XRA */
+		ScoreType score{};
+		/** @brief ŏI[x܂ŒT */
+		bool complete = false;
+	};
+
+	/**
+	 * @brief [xƂ̒T
+	 * @tparam Config
+	*/
+	template<class Config>
+	struct SearchProgress {
+		using ScoreType = typename Config::ScoreType;
+
+		/** @brief ̐[xiŗǂ̌܂ł̈̐j */
+		size_type depth = 0;
+		/** @brief ␔ */
+		size_type frontier = 0;
+		/** @brief ŗǂ̌̃XRA */
+		ScoreType bestScore{};
+		/** @brief oߎԁimsj */
+		double elapsed = 0;
+	};
+
+	namespace Lib {
+
+		/**
+		 * @brief T̍ŗǂ̌ʂƒT󋵂̒ʒm
+		 * @details ŗǂ̌ʂ͒TTm[hgݗĂBʃXbhǂݏoꍇ̂݁A[x̐؂ւƂɑgݗĂʂێ
+		 * @tparam Config
+		*/
+		template<class Config>
+		class SearchMonitor {
+		public:
+			using ArgumentType = typename Config::ArgumentType;
+			using ScoreType = typename Config::ScoreType;
+			/** @brief T󋵂̒ʒmifalseԂƒTIj */
+			using Callback = std::function<bool(const SearchProgress<Config>&)>;
+		private:
+			mutable std::mutex mutex{};
+			mutable std::condition_variable published{};
+			/** @brief ʃXbhɑgݗĂŗǂ̌ */
+			SearchResult<Config> best{};
+			/** @brief ʃXbȟʂgݗĂ */
+			size_type version = 0;
+			/** @brief T */
+			bool running = false;
+			/** @brief TXbh */
+			std::thread::id searchThread{};
+			/** @brief TɕʃXbhǂݏoꂽ */
+			mutable std::atomic<bool> watched{ false };
+			std::atomic<bool> stopRequested{ false };
+			Callback callback{};
+		public:
+			/**
+			 * @brief TJnɏ
+			 * @note TXbhĂяo
+			*/
+			void reset() {
+				std::lock_guard<std::mutex> lock(mutex);
+				best = SearchResult<Config>();
+				version = 0;
+				running = true;
+				searchThread = std::this_thread::get_id();
+				watched.store(false, std::memory_order_relaxed);
+				stopRequested.store(false, std::memory_order_relaxed);
+			}
+			/**
+			 * @brief T̏Iʒm
+			 * @details ȍ~̍ŗǂ̌ʂ͒Tm[hgݗĂ
+			*/
+			void finish() {
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					running = false;
+				}
+				published.notify_all();
+			}
+
+			/**
+			 * @brief T󋵂ʒm
+			 * @param progress T
+			 * @return T𑱂ꍇtrue
+			*/
+			bool notify(const SearchProgress<Config>& progress) {
+				if (callback && not callback(progress)) {
+					return false;
+				}
+				return not isStopRequested();
+			}
+
+			/**
+			 * @brief ʃXbhŗǂ̌ʂǂݏoĂ邩
+			*/
+			NODISCARD bool isWatched() const noexcept {
+				return watched.load(std::memory_order_relaxed);
+			}
+			/**
+			 * @brief ʃXbh̍ŗǂ̌ʂXV
+			 * @param result ŗǂ̌
+			*/
+			void store(SearchResult<Config>&& result) {
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					best = std::move(result);
+					version++;
+				}
+				published.notify_all();
+			}
+			/**
+			 * @brief TɕʃXbhŗǂ̌ʂǂݏo
+			 * @details ͒TXbh̐[x̐؂ւŌʂgݗĂ܂ő҂
+			 * @param result ŗǂ̌
+			 * @return TɕʃXbhĂяoꍇtrueiȊO͒Tm[hgݗĂj
+			*/
+			bool waitBest(SearchResult<Config>& result) const {
+				std::unique_lock<std::mutex> lock(mutex);
+				if (not running || searchThread == std::this_thread::get_id()) {
+					return false;
+				}
+				watched.store(true, std::memory_order_relaxed);
+				published.wait(lock, [&] { return not running || 0 < version; });
+				if (not running) {
+					return false;
+				}
+				result = best;
+				return true;
+			}
+
+			/**
+			 * @brief T󋵂̒ʒmݒ肷
+			 * @note TɕύXȂ
+			*/
+			void setCallback(Callback f) {
+				callback = std::move(f);
+			}
+
+			/** @brief T̏Iv */
+			void requestStop() noexcept {
+				stopRequested.store(true, std::memory_order_relaxed);
+			}
+			NODISCARD bool isStopRequested() const noexcept {
+				return stopRequested.load(std::memory_order_relaxed);
+			}
+		};
+	}
+}
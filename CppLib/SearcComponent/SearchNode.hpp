@@ -1,5 +1,10 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
 #include "Memo.hpp"
 
 namespace alib::Search::Lib {
@@ -32,12 +37,33 @@ namespace alib::Search::Lib {
 		void subRef() noexcept { ref--; }
 	};
 
-	template<class Config>
+	/**
+	 * @brief T
+	 * @details I΂܂ł̓m[h쐬Aem[hƈێ
+	*/
+	template<class Config, class Parent = typename SearchNode<Config>::pointer>
+	struct SearchCandidate {
+		using SearchMethod = typename Config::SearchMethod;
+		using pointer = Parent;
+
+		SearchCandidate() = default;
+		SearchCandidate(pointer parent, const SearchMethod& arg) noexcept : parent(parent), searchArgument(arg) {}
+
+		/** @brief em[hi|C^܂̓v[̔ԍj */
+		pointer parent{};
+		/** @brief T */
+		SearchMethod searchArgument{};
+
+		NODISCARD bool operator<(const SearchCandidate& o) const noexcept { return searchArgument.score < o.searchArgument.score; }
+		NODISCARD bool operator>(const SearchCandidate& o) const noexcept { return o < *this; }
+	};
+
+	template<class Config, class Node = SearchNode<Config>>
 	class SearchNodePool {
 	public:
-		using pointer = typename SearchNode<Config>::pointer;
+		using pointer = typename Node::pointer;
 	private:
-		PagingMemory<SearchNode<Config>, 16_K> pool{};
+		PagingMemory<Node, 16_K> pool{};
 		pointer top = nullptr;
 	public:
 		NODISCARD pointer alloc() {
@@ -56,4 +82,230 @@ namespace alib::Search::Lib {
 		}
 	};
 
+
+	/**
+	 * @brief ԑJڂŎQƂl݂̂Tm[h
+	 * @details em[h̓v[32bit̔ԍŎAT̓v[̕ʂ̔zɎ
+	*/
+	struct CompactSearchNode {
+		using index_type = std::uint32_t;
+		using PatchType = Memo::PatchType;
+
+		/** @brief m[hJڃpb`̐擪 */
+		PatchType::pointer patchData = nullptr;
+		/** @brief em[h̔ԍi0͐ej */
+		index_type parent = 0;
+		/** @brief m[hJڃpb`̃TCYibytej */
+		std::uint32_t patchSize = 0;
+		/** @brief QƃJEg */
+		int ref = 1;
+		/** @brief m[h[x */
+		int depth = 0;
+
+		NODISCARD PatchType patch() const noexcept { return PatchType(patchData, patchData + patchSize); }
+		void setPatch(const PatchType& patch) noexcept {
+			patchData = patch.address();
+			patchSize = narrow_cast<std::uint32_t>(patch.size());
+		}
+		NODISCARD bool hasPatch() const noexcept { return patchSize != 0; }
+
+		void addRef() noexcept { ref++; }
+		void subRef() noexcept { ref--; }
+	};
+
+	/**
+	 * @brief CompactSearchNode̊Ǘ
+	 * @details m[hƒTy[WPʂ̕ʁX̔zɎAԍŎQƂiԍ0͎gȂj
+	 * @tparam Argument Ť^
+	*/
+	template<class Argument>
+	class CompactNodePool {
+	public:
+		using Node = CompactSearchNode;
+		using index_type = Node::index_type;
+	private:
+		static constexpr size_type PageBits = 14;
+		static constexpr size_type PageSize = static_cast<size_type>(1) << PageBits;
+		static constexpr size_type PageMask = PageSize - 1;
+
+		std::vector<std::unique_ptr<Node[]>> nodePages{};
+		std::vector<std::unique_ptr<Argument[]>> argumentPages{};
+		/** @brief ς݃m[h̐擪i0͖j */
+		index_type top = 0;
+		/** @brief mۍς݂̃m[h */
+		size_type allocated = 0;
+
+		NODISCARD index_type allocNew() {
+			const size_type index = allocated + 1;
+			if (nodePages.size() * PageSize <= index) {
+				nodePages.push_back(std::make_unique<Node[]>(PageSize));
+				argumentPages.push_back(std::make_unique<Argument[]>(PageSize));
+			}
+			allocated++;
+			return narrow_cast<index_type>(index);
+		}
+	public:
+		NODISCARD Node& node(const index_type index) noexcept { return nodePages[index >> PageBits][index & PageMask]; }
+		NODISCARD const Node& node(const index_type index) const noexcept { return nodePages[index >> PageBits][index & PageMask]; }
+		NODISCARD Argument& argument(const index_type index) noexcept { return argumentPages[index >> PageBits][index & PageMask]; }
+		NODISCARD const Argument& argument(const index_type index) const noexcept { return argumentPages[index >> PageBits][index & PageMask]; }
+
+		NODISCARD index_type alloc() {
+			if (top != 0) {
+				const index_type index = top;
+				top = node(index).parent;
+				return index;
+			}
+			else {
+				return allocNew();
+			}
+		}
+		void release(const index_type index) noexcept {
+			node(index).parent = top;
+			top = index;
+		}
+
+		/**
+		 * @brief em[h̖m[h쐬
+		 * @return m[h̔ԍ
+		*/
+		NODISCARD index_type create() {
+			const index_type index = alloc();
+			node(index) = Node();
+			return index;
+		}
+		/**
+		 * @brief qm[h쐬
+		 * @param parent em[h̔ԍ
+		 * @param arg T
+		 * @return m[h̔ԍ
+		*/
+		NODISCARD index_type create(const index_type parent, const Argument& arg) {
+			assert(parent != 0);
+			const index_type index = alloc();
+			auto& parentNode = node(parent);
+			auto& child = node(index);
+			child = Node();
+			child.parent = parent;
+			child.depth = parentNode.depth + 1;
+			parentNode.addRef();
+			argument(index) = arg;
+			return index;
+		}
+	};
+
+	/**
+	 * @brief ԑJڂœKppb`͈̔
+	*/
+	struct TransitionPath {
+		/** @brief Kppb`̐擪ʒuiꎞ̖̈܂łKpj */
+		size_type first = 0;
+		/** @brief ߂pb`ƓKppb`̍vTCYibytej */
+		size_type bytes = 0;
+	};
+
+	/**
+	 * @brief ʂ̑coRԑJڂ̃pb`W߂
+	 * @details Jڌ狤ʂ̑c܂ł̃pb`͖߂ undo ɓnAʂ̑c悩Jڐ܂ł̃pb`͓Kp鏇 redos ̖ɋl߂
+	 * @param pool m[hǗ
+	 * @param current Jڌ
+	 * @param target Jڐ
+	 * @param redos Kppb`̈ꎞ̈iT[xȏ̃TCYj
+	 * @param undo ߂pb`󂯎֐
+	 * @return Kppb`͈̔
+	*/
+	template<class Pool, class Redos, class Undo>
+	NODISCARD TransitionPath CollectTransition(const Pool& pool, typename Pool::index_type current, typename Pool::index_type target, Redos& redos, Undo&& undo) noexcept {
+		TransitionPath path{ static_cast<size_type>(redos.size()), 0 };
+		while (current != target) {
+			assert(current != 0);
+			assert(target != 0);
+			const auto& currentNode = pool.node(current);
+			const auto& targetNode = pool.node(target);
+			if (currentNode.depth < targetNode.depth) {
+				if (targetNode.hasPatch()) {
+					path.first--;
+					WARN_PUSH_DISABLE(26446 26482);
+					redos[path.first] = targetNode.patch();
+					WARN_POP();
+					path.bytes += targetNode.patchSize;
+				}
+				target = targetNode.parent;
+			}
+			else {
+				if (currentNode.hasPatch()) {
+					undo(currentNode.patch());
+					path.bytes += currentNode.patchSize;
+				}
+				current = currentNode.parent;
+			}
+		}
+		return path;
+	}
+
+	/**
+	 * @brief c悩Jڐ܂ł̃pb`Kp鏇 redos ̖ɋl߂
+	 * @param pool m[hǗ
+	 * @param target Jڐ
+	 * @param ancestor Jڐ̑cipb`͊܂܂Ȃj
+	 * @param redos Kppb`̈ꎞ̈
+	 * @return Kppb`̐擪ʒu
+	*/
+	template<class Pool, class Redos>
+	NODISCARD size_type CollectRedos(const Pool& pool, typename Pool::index_type target, const typename Pool::index_type ancestor, Redos& redos) noexcept {
+		size_type first = redos.size();
+		for (; target != ancestor; target = pool.node(target).parent) {
+			assert(target != 0);
+			const auto& node = pool.node(target);
+			if (node.hasPatch()) {
+				first--;
+				WARN_PUSH_DISABLE(26446 26482);
+				redos[first] = node.patch();
+				WARN_POP();
+			}
+		}
+		return first;
+	}
+
+	/**
+	 * @brief redos ɋl߂pb`Kp
+	 * @param redos Kppb`̈ꎞ̈
+	 * @param first Kppb`̐擪ʒu
+	 * @param shift L^ꂽAhXɉ邸ibytej
+	 * @return Kppb`
+	*/
+	template<class Redos>
+	size_type ApplyRedos(const Redos& redos, const size_type first, const std::ptrdiff_t shift = 0) noexcept {
+		const size_type size = redos.size();
+		forstep(idx, first, size) {
+			WARN_PUSH_DISABLE(26446 26482);
+			redos[idx].redo(shift);
+			WARN_POP();
+		}
+		return size - first;
+	}
+
+	/**
+	 * @brief m[h̎QƂOAQƂȂc܂ł
+	 * @details em[hċAɂǂ
+	 * @param pool m[hǗ
+	 * @param index m[h̔ԍ
+	 * @param onRelease v[ɕԂOɔԍƃm[h󂯎֐
+	*/
+	template<class Pool, class OnRelease>
+	void ReleaseNode(Pool& pool, typename Pool::index_type index, OnRelease&& onRelease) {
+		assert(index != 0);
+		while (index != 0) {
+			auto& node = pool.node(index);
+			assert(0 < node.ref);
+			if (node.ref != 1) {
+				node.subRef();
+				return;
+			}
+			const auto parent = node.parent;
+			onRelease(index, node);
+			pool.release(index);
+			index = parent;
+		}
+	}
 }
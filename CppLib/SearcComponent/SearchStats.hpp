@@ -0,0 +1,152 @@
+#pragma once
+
+#include <vector>
+
+#include "SearchComponentLib.hpp"
+#include "Timer.hpp"
+
+namespace alib::Search {
+
+	/**
+	 * @brief [xƂ̒T̓v
+	 * @note [x0͏̃p^[̐iinitjŁA\񐔂͂̐[xœWJm[h\񂵂␔
+	*/
+	struct DepthStats {
+		/** @brief \񂵂␔ */
+		size_type reserved = 0;
+		/** @brief WJm[h */
+		size_type accepted = 0;
+		/** @brief nbVvŃXLbvm[h */
+		size_type skipped = 0;
+		/** @brief ԑJڂŖ߂pb` */
+		size_type undo = 0;
+		/** @brief ԑJڂœKpb` */
+		size_type redo = 0;
+		/** @brief L^̃TCYibytej */
+		size_type committedBytes = 0;
+		/** @brief TiinitEsearchj̎ԁimsj */
+		double searchTime = 0;
+		/** @brief [xŜ̎ԁimsj */
+		double totalTime = 0;
+
+		/** @brief TȊO̎ԁimsj */
+		NODISCARD double overheadTime() const noexcept { return totalTime - searchTime; }
+
+		DepthStats& operator+=(const DepthStats& o) noexcept {
+			reserved += o.reserved;
+			accepted += o.accepted;
+			skipped += o.skipped;
+			undo += o.undo;
+			redo += o.redo;
+			committedBytes += o.committedBytes;
+			searchTime += o.searchTime;
+			totalTime += o.totalTime;
+			return *this;
+		}
+	};
+
+	namespace Lib {
+
+		/**
+		 * @brief T̓v̋L^
+		 * @details ̏ꍇ͉L^Ȃ
+		 * @tparam Enabled L^
+		*/
+		template<bool Enabled>
+		class SearchStats {
+		public:
+			void clear() noexcept {}
+			void beginDepth(size_type, double) noexcept {}
+			void finish(double) noexcept {}
+
+			void addReserved() noexcept {}
+			void addAccepted() noexcept {}
+			void addSkipped() noexcept {}
+			void addUndo(size_type) noexcept {}
+			void addRedo(size_type) noexcept {}
+			void addCommitted(size_type) noexcept {}
+
+			void beginSearch() noexcept {}
+			void endSearch() noexcept {}
+		};
+
+		template<>
+		class SearchStats<true> {
+		private:
+			std::vector<DepthStats> depths{};
+			/** @brief [x̊Jnԁimsj */
+			double depthStart = 0;
+			/** @brief T̊Jnԁimsj */
+			double searchStart = 0;
+			Timer timer{};
+
+			NODISCARD DepthStats& current() noexcept {
+				return depths.back();
+			}
+		public:
+			SearchStats() {
+				clear();
+			}
+
+			void clear() {
+				depths.assign(1, DepthStats());
+				timer.start();
+				depthStart = 0;
+				searchStart = 0;
+			}
+
+			/**
+			 * @brief [x̋L^Jn
+			 * @param depth [xĩp^[̐0j
+			 * @param elapsed Ťoߎԁimsj
+			*/
+			void beginDepth(const size_type depth, const double elapsed) {
+				finish(elapsed);
+				// L^͏ɖ̐[x
+				depths.resize(depth + 1);
+				depthStart = elapsed;
+			}
+			/**
+			 * @brief ݂̐[x̋L^I
+			 * @param elapsed Ťoߎԁimsj
+			*/
+			void finish(const double elapsed) noexcept {
+				current().totalTime += elapsed - depthStart;
+				depthStart = elapsed;
+			}
+
+			void addReserved() noexcept { current().reserved++; }
+			void addAccepted() noexcept { current().accepted++; }
+			void addSkipped() noexcept { current().skipped++; }
+			void addUndo(const size_type count) noexcept { current().undo += count; }
+			void addRedo(const size_type count) noexcept { current().redo += count; }
+			void addCommitted(const size_type bytes) noexcept { current().committedBytes += bytes; }
+
+			/** @brief ŤvJn */
+			void beginSearch() noexcept {
+				searchStart = timer.interval();
+			}
+			/** @brief ŤvI */
+			void endSearch() noexcept {
+				current().searchTime += timer.interval() - searchStart;
+			}
+
+			/**
+			 * @brief [xƂ̓v
+			*/
+			NODISCARD const std::vector<DepthStats>& getDepths() const noexcept {
+				return depths;
+			}
+			/**
+			 * @brief S[x̍v
+			*/
+			NODISCARD DepthStats total() const noexcept {
+				DepthStats result;
+				for (const auto& depth : depths) {
+					result += depth;
+				}
+				return result;
+			}
+		};
+	}
+}
@@ -65,7 +65,7 @@ namespace alib::Search::Lib {
 			assert(length <= size());
 			assert(length <= stream.capacity());
 			sub(length);
-			std::memcpy(stream.last, last, length);
+			CopyBytes(stream.last, last, length);
 			stream.add(length);
 		}
 
@@ -78,7 +78,7 @@ namespace alib::Search::Lib {
 
 		void copy(void* ptr, const size_type length) noexcept {
 			assert(length <= capacity());
-			std::memcpy(last, ptr, length);
+			CopyBytes(last, ptr, length);
 			add(length);
 		}
 
@@ -89,7 +89,7 @@ namespace alib::Search::Lib {
 
 		void write(void* ptr, const size_type length) noexcept {
 			assert(length <= capacity());
-			std::memcpy(ptr, last, length);
+			CopyBytes(ptr, last, length);
 			add(length);
 		}
 
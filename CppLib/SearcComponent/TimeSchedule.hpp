@@ -0,0 +1,106 @@
+#pragma once
+
+#include "SearchComponentLib.hpp"
+
+namespace alib::Search::Lib {
+
+	/**
+	 * @brief ̐[x̒Tv
+	*/
+	struct TimePlan {
+		/** @brief Tł؂oߎԁimsj */
+		double deadline = 0;
+		/** @brief WJm[h */
+		size_type width = 0;
+	};
+
+	/**
+	 * @brief c莞Ԃc̐[xŋϓɕ鎞Ԕz
+	*/
+	class EvenTimeSchedule {
+	private:
+		double limit = 0;
+	public:
+		/**
+		 * @brief TJnɏ
+		 * @param limit Tԁimsj
+		 * @param interval oߎԁimsj
+		*/
+		void reset(const double limit, const double) noexcept {
+			this->limit = limit;
+		}
+		/**
+		 * @brief I[xL^
+		 * @param expanded WJm[h
+		 * @param interval oߎԁimsj
+		*/
+		void record(const size_type, const double) noexcept {}
+
+		/**
+		 * @brief ̐[x̒Tv
+		 * @param interval oߎԁimsj
+		 * @param remainDepth ̐[x܂ގc̐[x
+		 * @param width ̐[x̊̓WJ
+		 * @param maxWidth ̐[x̓WJ̏
+		*/
+		NODISCARD TimePlan next(const double interval, const int remainDepth, const size_type width, const size_type) const noexcept {
+			return TimePlan{ ((limit - interval) / remainDepth) + interval, width };
+		}
+	};
+
+	/**
+	 * @brief WJm[h̎Ԃ[xƂ̓WJ𒲐鎞Ԕz
+	 * @details c莞Ԃc̐[xŋϓɕA̎ԂɎ܂WJ𒼋߂̐[x̎т猩ς
+	 * @tparam MaxScale WJ̏̊̓WJɑ΂{
+	 * @tparam Margin ςɎgԂ̊i%j
+	*/
+	template<size_type MaxScale = 4, size_type Margin = 90>
+	class AdaptiveTimeSchedule {
+	private:
+		double limit = 0;
+		/** @brief m[h̎ԁimsj */
+		double cost = 0;
+		/** @brief [x̊Jnԁimsj */
+		double depthStart = 0;
+		bool measured = false;
+	public:
+		void reset(const double limit, const double interval) noexcept {
+			this->limit = limit;
+			cost = 0;
+			depthStart = interval;
+			measured = false;
+		}
+
+		void record(const size_type expanded, const double interval) noexcept {
+			const double elapsed = interval - depthStart;
+			depthStart = interval;
+			if (expanded == 0) {
+				return;
+			}
+			const double current = elapsed / static_cast<double>(expanded);
+			// ߂̐[xdĕ
+			cost = measured ? (cost + current) / 2 : current;
+			measured = true;
+		}
+
+		NODISCARD TimePlan next(const double interval, const int remainDepth, const size_type width, const size_type maxWidth) const noexcept {
+			const double budget = (limit - interval) / remainDepth;
+			if (not measured || cost <= 0) {
+				return TimePlan{ interval + budget, width };
+			}
+
+			const size_type upper = width * MaxScale < maxWidth ? width * MaxScale : maxWidth;
+			const double fit = budget * static_cast<double>(Margin) / 100.0 / cost;
+			if (fit < 1) {
+				return TimePlan{ interval + budget, 1 };
+			}
+			else if (fit < static_cast<double>(upper)) {
+				return TimePlan{ interval + budget, static_cast<size_type>(fit) };
+			}
+			else {
+				return TimePlan{ interval + budget, upper };
+			}
+		}
+	};
+
+}
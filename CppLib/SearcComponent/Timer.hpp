@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 #include "../Basic.hpp"
 
@@ -27,4 +28,81 @@ namespace alib::Search::Lib {
 		}
 	};
 
+	/**
+	 * @brief ߐ؂̔Ŏ̓ǂݏoԈ^C}[
+	 * @details Ăяo1񂠂̎ԂAǂݏo̊Ԋue덷Ɏ܂񐔂ɒ
+	*/
+	class DeadlineTimer {
+	private:
+		Timer timer{};
+		/** @brief e덷imsj */
+		double tolerance = 0;
+		/** @brief O̓ǂݏoԁimsj */
+		double lastRead = 0;
+		/** @brief ǂݏo̊ԊuiĂяo񐔁j */
+		size_t stride = 1;
+		/** @brief ̓ǂݏo܂ł̌Ăяo */
+		size_t countdown = 0;
+
+		static constexpr size_t MaxStride = 1 << 16;
+	public:
+		/**
+		 * @brief RXgN^
+		 * @param tolerance ߐ؂𒴂Ă悢ԁimsA0̏ꍇ͖ǂݏoj
+		*/
+		explicit DeadlineTimer(const double tolerance = 0) noexcept : tolerance(tolerance) {}
+
+		/** @brief ^C}[Jn */
+		void start() noexcept {
+			timer.start();
+			lastRead = 0;
+			stride = 1;
+			countdown = 0;
+		}
+
+		/** @brief oߎԁimsj */
+		NODISCARD double interval() noexcept {
+			lastRead = timer.interval();
+			countdown = stride - 1;
+			return lastRead;
+		}
+
+		/**
+		 * @brief ߐ؂ɒB
+		 * @param deadline ߐ؂̌oߎԁimsj
+		 * @return Bꍇtrueiőŋe덷xČoj
+		*/
+		NODISCARD bool reached(const double deadline) noexcept {
+			if (0 < countdown) {
+				countdown--;
+				return false;
+			}
+
+			const double previous = lastRead;
+			const size_t calls = stride;
+			const double now = timer.interval();
+			lastRead = now;
+			if (deadline <= now) {
+				countdown = 0;
+				return true;
+			}
+
+			// 1񂠂̎Ԃ狖e덷ƒߐ؂܂ł̎cɎ܂Ԋu߂
+			const double perCall = (now - previous) / static_cast<double>(calls);
+			const double allowed = std::min(tolerance, deadline - now);
+			size_t next = 1;
+			if (0 < perCall) {
+				const double fit = allowed / perCall;
+				next = fit < 1 ? 1 : (fit < static_cast<double>(MaxStride) ? static_cast<size_t>(fit) : MaxStride);
+			}
+			else if (0 < allowed) {
+				next = stride * 2;
+			}
+			// }ɊԊuLȂ
+			stride = std::min({ next, stride * 2, MaxStride });
+			countdown = stride - 1;
+			return false;
+		}
+	};
+
 }
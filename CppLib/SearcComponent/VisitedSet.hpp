@@ -0,0 +1,199 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "SearchComponentLib.hpp"
+
+namespace alib::Search::Lib {
+
+	/**
+	 * @brief Tς݃nbVƒl̕\
+	 * @details eʂ2̗ݏ̐`T̃nbV\ŁAԍ̍XVO(1)ŋɂ
+	 * @note gp𒴂ꍇ̂݊gAȊOł̓mۂȂ
+	 * @tparam Mapped ľ^
+	*/
+	template<class Mapped>
+	class VisitedMap {
+	public:
+		using key_type = size_t;
+		using mapped_type = Mapped;
+	private:
+		struct Slot {
+			key_type key = 0;
+			/** @brief o^i݂̐ƈvꍇ̂ݗLj */
+			std::uint32_t generation = 0;
+			mapped_type value{};
+		};
+
+		std::vector<Slot> table{};
+		/** @brief ݂̐ */
+		std::uint32_t generation = 1;
+		size_type count = 0;
+		size_type mask = 0;
+		/** @brief ʒu̎ZoŎ̂Ă鉺ʃrbg */
+		int shift = 64;
+
+		NODISCARD size_type position(const key_type key) const noexcept {
+			// ΂nbVlłU΂悤ɏZō
+			return static_cast<size_type>((static_cast<std::uint64_t>(key) * 0x9E3779B97F4A7C15ull) >> shift);
+		}
+
+		/**
+		 * @brief o^ʒu
+		 * @return o^ʒuio^̏ꍇ͕\̑傫j
+		*/
+		NODISCARD size_type locate(const key_type key) const noexcept {
+			if (table.empty()) {
+				return table.size();
+			}
+			for (size_type idx = position(key);; idx = (idx + 1) & mask) {
+				const auto& slot = table[idx];
+				if (slot.generation != generation) {
+					return table.size();
+				}
+				if (slot.key == key) {
+					return idx;
+				}
+			}
+		}
+
+		void rehash(const size_type capacity) {
+			std::vector<Slot> old(capacity);
+			std::swap(table, old);
+			mask = capacity - 1;
+			shift = 64;
+			for (size_type size = capacity; 1 < size; size >>= 1) {
+				shift--;
+			}
+
+			count = 0;
+			const auto oldGeneration = generation;
+			generation = 1;
+			for (const auto& slot : old) {
+				if (slot.generation == oldGeneration) {
+					*try_emplace(slot.key).first = slot.value;
+				}
+			}
+		}
+	public:
+		VisitedMap() = default;
+		/**
+		 * @param capacity eʁi0̏ꍇ͍ŏ̓o^܂ŊmۂȂj
+		*/
+		explicit VisitedMap(const size_type capacity) {
+			if (0 < capacity) {
+				reserve(capacity);
+			}
+		}
+
+		/**
+		 * @brief w萔gɓo^ł悤Ɋmۂ
+		 * @param capacity o^
+		*/
+		void reserve(const size_type capacity) {
+			size_type size = 16;
+			while (size < capacity * 2) {
+				size <<= 1;
+			}
+			if (table.size() < size) {
+				rehash(size);
+			}
+		}
+
+		/**
+		 * @brief Sč폜
+		*/
+		void clear() noexcept {
+			count = 0;
+			generation++;
+			if (generation == 0) {
+				// ԍꍇ̂ݑŜ
+				for (auto& slot : table) {
+					slot.generation = 0;
+				}
+				generation = 1;
+			}
+		}
+
+		/**
+		 * @brief o^̏ꍇ̂ݓo^
+		 * @param key nbVl
+		 * @return l̃|C^ƁAo^ꍇtrue
+		 * @note o^ꍇ̒l͏lŁA|C^͎̓o^܂ŗL
+		*/
+		std::pair<mapped_type*, bool> try_emplace(const key_type key) {
+			if (table.size() < (count + 1) * 2) {
+				rehash(table.empty() ? 16 : table.size() * 2);
+			}
+			for (size_type idx = position(key);; idx = (idx + 1) & mask) {
+				auto& slot = table[idx];
+				if (slot.generation != generation) {
+					slot.key = key;
+					slot.generation = generation;
+					slot.value = mapped_type{};
+					count++;
+					return { std::addressof(slot.value), true };
+				}
+				if (slot.key == key) {
+					return { std::addressof(slot.value), false };
+				}
+			}
+		}
+
+		/**
+		 * @brief 
+		 * @param key nbVl
+		 * @return l̃|C^io^̏ꍇnullptrj
+		*/
+		NODISCARD mapped_type* find(const key_type key) noexcept {
+			const auto idx = locate(key);
+			return idx < table.size() ? std::addressof(table[idx].value) : nullptr;
+		}
+		NODISCARD const mapped_type* find(const key_type key) const noexcept {
+			const auto idx = locate(key);
+			return idx < table.size() ? std::addressof(table[idx].value) : nullptr;
+		}
+
+		NODISCARD bool contains(const key_type key) const noexcept {
+			return locate(key) < table.size();
+		}
+
+		NODISCARD size_type size() const noexcept { return count; }
+		NODISCARD bool empty() const noexcept { return count == 0; }
+		NODISCARD size_type capacity() const noexcept { return table.size() / 2; }
+	};
+
+	/**
+	 * @brief Tς݃nbV̏W
+	 * @details VisitedMap̒lȂ
+	*/
+	class VisitedSet {
+	private:
+		struct Empty {};
+		VisitedMap<Empty> map{};
+	public:
+		using key_type = VisitedMap<Empty>::key_type;
+
+		VisitedSet() = default;
+		explicit VisitedSet(const size_type capacity) : map(capacity) {}
+
+		void reserve(const size_type capacity) { map.reserve(capacity); }
+		void clear() noexcept { map.clear(); }
+
+		/**
+		 * @brief o^̏ꍇ̂ݓo^
+		 * @param key nbVl
+		 * @return o^ꍇtrue
+		*/
+		bool insert(const key_type key) { return map.try_emplace(key).second; }
+
+		NODISCARD bool contains(const key_type key) const noexcept { return map.contains(key); }
+		NODISCARD size_type size() const noexcept { return map.size(); }
+		NODISCARD bool empty() const noexcept { return map.empty(); }
+		NODISCARD size_type capacity() const noexcept { return map.capacity(); }
+	};
+
+}
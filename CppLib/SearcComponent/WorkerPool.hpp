@@ -0,0 +1,121 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <cassert>
+
+#include "SearchComponentLib.hpp"
+
+namespace alib::Search::Lib {
+
+	/**
+	 * @brief [xƂɓJԂ[J[Xbh
+	 * @details Xbh start 1񂾂쐬Adispatch ŏJn wait őSXbh̊҂
+	*/
+	class WorkerPool {
+	public:
+		/** @brief [J[̏i̓[J[̔ԍj */
+		using Task = std::function<void(size_type)>;
+	private:
+		std::vector<std::thread> threads{};
+		Task task{};
+
+		std::mutex mutex{};
+		/** @brief ̊Jn̒ʒm */
+		std::condition_variable wake{};
+		/** @brief ̊̒ʒm */
+		std::condition_variable done{};
+		/** @brief Jn̉ */
+		size_type generation = 0;
+		/** @brief ̃[J[ */
+		size_type pending = 0;
+		bool stopping = false;
+
+		void run(const size_type index) {
+			size_type seen = 0;
+			while (true) {
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					wake.wait(lock, [&] { return stopping || seen != generation; });
+					if (stopping) {
+						return;
+					}
+					seen = generation;
+				}
+				task(index);
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					pending--;
+					if (pending == 0) {
+						done.notify_one();
+					}
+				}
+			}
+		}
+	public:
+		WorkerPool() = default;
+		WorkerPool(const WorkerPool&) = delete;
+		WorkerPool& operator=(const WorkerPool&) = delete;
+		~WorkerPool() {
+			stop();
+		}
+
+		/**
+		 * @brief [J[Xbh쐬
+		 * @param count [J[
+		 * @param work [J[̏
+		*/
+		void start(const size_type count, Task work) {
+			assert(threads.empty());
+			task = std::move(work);
+			stopping = false;
+			forange(idx, count) {
+				threads.emplace_back([this, idx] { run(idx); });
+			}
+		}
+
+		/**
+		 * @brief S[J[ŏ1Jn
+		 * @note Ăяo̕ύX͏QƂł
+		*/
+		void dispatch() {
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				generation++;
+				pending = threads.size();
+			}
+			wake.notify_all();
+		}
+		/**
+		 * @brief Jn̊҂
+		*/
+		void wait() {
+			std::unique_lock<std::mutex> lock(mutex);
+			done.wait(lock, [&] { return pending == 0; });
+		}
+
+		/**
+		 * @brief [J[XbhI
+		*/
+		void stop() {
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				stopping = true;
+			}
+			wake.notify_all();
+			for (auto& thread : threads) {
+				thread.join();
+			}
+			threads.clear();
+		}
+
+		NODISCARD size_type size() const noexcept {
+			return threads.size();
+		}
+	};
+
+}
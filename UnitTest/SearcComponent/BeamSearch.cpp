@@ -71,6 +71,8 @@ namespace SearcComponent::BeamSearchTest {
 
 		using Method = alib::Search::DefaultSearchMethod<Arg>;
 		using Config = alib::Search::ConfigTemplate<3, 10, 2000 * 1000, Method>;
+		// nbVȂꍇ͒Tς݃nbVmۂȂ
+		static_assert(alib::Search::Lib::GetVisitedCapacity<Config>() == 0);
 
 		class Beam : public alib::Search::BeamSearchTemplate<Config, Beam> {
 		public:
@@ -110,4 +112,1137 @@ namespace SearcComponent::BeamSearchTest {
 		ASSERT_EQ(9, result[2].value);
 	}
 
+	/**
+	 * @brief ␔̋@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, BeamSearch_FuncTest03) {
+
+		struct Arg {
+			Arg() {}
+			Arg(const int v) : value(v) {}
+			int value{};
+		};
+
+		using Method = alib::Search::DefaultSearchMethod<Arg, double, size_t>;
+		struct Config : public alib::Search::ConfigTemplate<5, 10, 2000 * 1000, Method> {
+			NODISCARD inline static constexpr bool UseBoundedRanking() noexcept { return true; }
+		};
+
+		class Beam : public alib::Search::BeamSearchTemplate<Config, Beam> {
+		public:
+			using base = alib::Search::BeamSearchTemplate<Config, Beam>;
+			using SearchMethod = base::SearchMethod;
+			using Reference = alib::Search::MemoType<Beam>;
+
+		private:
+
+			Reference::Array<Reference::Value<int>, 5> list;
+
+		public:
+
+			void init(const SearchMethod&) noexcept override {
+				forange_type(int, i, 10) {
+					nextSearch(i, i, i);
+				}
+			}
+
+			void search(const SearchMethod& arg) noexcept override {
+				const auto depth = getDepth();
+				list[depth] = arg.argument.value;
+				// E~ĉ̓ւ𔭐
+				forange_type(int, i, 10) {
+					const int v = (i % 2 == 0) ? i : 10 - i;
+					nextSearch(arg.score + v, arg.hash * 10 + v, v);
+				}
+			}
+
+		};
+
+		Beam beam;
+		beam.start({});
+		const auto result = beam.getResultList();
+
+		ASSERT_EQ(5, result.size());
+		for (const auto& arg : result) {
+			ASSERT_EQ(9, arg.value);
+		}
+	}
+
+	/**
+	 * @brief WJ̔rp̒T
+	 * @tparam Config
+	*/
+	template<class Config>
+	class OrderedBeam final : public alib::Search::BeamSearchTemplate<Config, OrderedBeam<Config>> {
+	public:
+		using base = alib::Search::BeamSearchTemplate<Config, OrderedBeam<Config>>;
+		using SearchMethod = typename base::SearchMethod;
+		using Reference = alib::Search::MemoType<OrderedBeam<Config>>;
+
+	private:
+
+		typename Reference::template Array<typename Reference::template Value<int>, 6> list;
+
+	public:
+
+		void init(const SearchMethod&) noexcept override {
+			forange_type(int, i, 10) {
+				this->nextSearch(i, i, i);
+			}
+		}
+
+		void search(const SearchMethod& arg) noexcept override {
+			const auto depth = this->getDepth();
+			list[depth] = arg.argument;
+			// eƂɎq̃XRA̕тςāAʂ̌𕡐̐eɎU炷
+			forange_type(int, i, 10) {
+				const int v = (i * 3 + arg.argument * 7) % 10;
+				this->nextSearch(arg.score + v, arg.hash * 10 + v, v);
+			}
+		}
+
+	};
+
+	/**
+	 * @brief em[h̓WJ̋@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, BeamSearch_FuncTest04) {
+
+		using Method = alib::Search::DefaultSearchMethod<int, double, size_t>;
+		using DefaultConfig = alib::Search::ConfigTemplate<6, 20, 2000 * 1000, Method>;
+		struct GroupedConfig : public DefaultConfig {
+			NODISCARD inline static constexpr bool UseGroupedExpansion() noexcept { return true; }
+		};
+		struct GroupedBoundedConfig : public GroupedConfig {
+			NODISCARD inline static constexpr bool UseBoundedRanking() noexcept { return true; }
+		};
+
+		OrderedBeam<DefaultConfig> beam;
+		beam.start({});
+		OrderedBeam<GroupedConfig> grouped;
+		grouped.start({});
+		OrderedBeam<GroupedBoundedConfig> bounded;
+		bounded.start({});
+
+		const auto expected = beam.getResultList();
+		ASSERT_EQ(6, expected.size());
+		for (const auto& arg : expected) {
+			ASSERT_EQ(9, arg);
+		}
+		ASSERT_EQ(expected, grouped.getResultList());
+		ASSERT_EQ(expected, bounded.getResultList());
+
+		ASSERT_LT(grouped.getTransitionCounter().redo, beam.getTransitionCounter().redo);
+		ASSERT_LT(grouped.getTransitionCounter().undo, beam.getTransitionCounter().undo);
+		ASSERT_LT(bounded.getTransitionCounter().redo, beam.getTransitionCounter().redo);
+	}
+
+	/**
+	 * @brief d̔rp̒T
+	 * @details vlnbVƂAvlɈقȂXRAœB
+	 * @tparam Config
+	*/
+	template<class Config>
+	class DedupeBeam : public alib::Search::BeamSearchTemplate<Config, DedupeBeam<Config>> {
+	public:
+		using base = alib::Search::BeamSearchTemplate<Config, DedupeBeam<Config>>;
+		using SearchMethod = typename base::SearchMethod;
+		using Reference = alib::Search::MemoType<DedupeBeam<Config>>;
+
+	private:
+
+		typename Reference::template Value<int> total;
+		typename Reference::template Value<int> squares;
+
+	public:
+
+		void init(const SearchMethod&) noexcept override {
+			forange_type(int, i, 10) {
+				this->nextSearch(i * i, i, i);
+			}
+		}
+
+		void search(const SearchMethod& arg) noexcept override {
+			total = total + arg.argument;
+			squares = squares + arg.argument * arg.argument;
+
+			// u̐em[hJڂĂ邱
+			EXPECT_EQ(arg.hash, static_cast<size_t>(total.load()));
+			EXPECT_EQ(arg.score, squares.load());
+
+			forange_type(int, i, 10) {
+				this->nextSearch(arg.score + i * i, arg.hash + i, i);
+			}
+		}
+
+	};
+
+	/**
+	 * @brief d͈̔͂̔rp̒T
+	 * @details Ԃ̒lnbVƂA[x̏dil3jƑO̐[x̏dil2j1\񂷂
+	 * @tparam Config
+	*/
+	template<class Config>
+	class ScopeBeam : public alib::Search::BeamSearchTemplate<Config, ScopeBeam<Config>> {
+	public:
+		using base = alib::Search::BeamSearchTemplate<Config, ScopeBeam<Config>>;
+		using SearchMethod = typename base::SearchMethod;
+		using Reference = alib::Search::MemoType<ScopeBeam<Config>>;
+
+	private:
+
+		typename Reference::template Value<int> value;
+
+	public:
+
+		void init(const SearchMethod&) noexcept override {
+			this->nextSearch(10, 1, 1);
+			this->nextSearch(5, 2, 2);
+		}
+
+		void search(const SearchMethod& arg) noexcept override {
+			value = arg.argument;
+			EXPECT_EQ(arg.hash, static_cast<size_t>(value.load()));
+
+			switch (arg.argument) {
+			case 1:
+				// O̐[xŗ\񂵂l2ɍłXRAŖ߂
+				this->nextSearch(arg.score + 10, 2, 2);
+				this->nextSearch(arg.score + 1, 3, 3);
+				break;
+			case 2:
+				// l3ɒႢXRAœB
+				this->nextSearch(arg.score + 3, 3, 3);
+				this->nextSearch(arg.score + 1, 4, 4);
+				break;
+			default:
+				this->nextSearch(arg.score, arg.argument * 10, arg.argument * 10);
+				break;
+			}
+		}
+
+	};
+
+	/**
+	 * @brief \񎞂̏d̋@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, BeamSearch_FuncTest05) {
+
+		using Method = alib::Search::DefaultSearchMethod<int, int, size_t>;
+		using BaseConfig = alib::Search::ConfigTemplate<6, 8, 2000 * 1000, Method>;
+		struct DepthConfig : public BaseConfig {
+			NODISCARD inline static constexpr alib::Search::DedupeScope GetDedupeScope() noexcept { return alib::Search::DedupeScope::Depth; }
+		};
+		struct GlobalConfig : public BaseConfig {
+			NODISCARD inline static constexpr alib::Search::DedupeScope GetDedupeScope() noexcept { return alib::Search::DedupeScope::Global; }
+		};
+		struct BoundedConfig : public DepthConfig {
+			NODISCARD inline static constexpr bool UseBoundedRanking() noexcept { return true; }
+		};
+		struct GroupedConfig : public GlobalConfig {
+			NODISCARD inline static constexpr bool UseGroupedExpansion() noexcept { return true; }
+		};
+
+		DedupeBeam<BaseConfig> beam;
+		beam.start({});
+		DedupeBeam<DepthConfig> depth;
+		depth.start({});
+		DedupeBeam<GlobalConfig> global;
+		global.start({});
+		DedupeBeam<BoundedConfig> bounded;
+		bounded.start({});
+		DedupeBeam<GroupedConfig> grouped;
+		grouped.start({});
+
+		const std::vector<int> expected(6, 9);
+		ASSERT_EQ(expected, beam.getResultList());
+		ASSERT_EQ(expected, depth.getResultList());
+		ASSERT_EQ(expected, global.getResultList());
+		ASSERT_EQ(expected, bounded.getResultList());
+		ASSERT_EQ(expected, grouped.getResultList());
+		// ͈͂ƂɓWJɃXLbvdقȂ
+		using ScopeConfig = alib::Search::ConfigTemplate<3, 2, 2000 * 1000, Method, true>;
+		struct ScopeDepthConfig : public ScopeConfig {
+			NODISCARD inline static constexpr alib::Search::DedupeScope GetDedupeScope() noexcept { return alib::Search::DedupeScope::Depth; }
+		};
+		struct ScopeGlobalConfig : public ScopeConfig {
+			NODISCARD inline static constexpr alib::Search::DedupeScope GetDedupeScope() noexcept { return alib::Search::DedupeScope::Global; }
+		};
+
+		ScopeBeam<ScopeConfig> scopeExpand;
+		scopeExpand.start({});
+		ScopeBeam<ScopeDepthConfig> scopeDepth;
+		scopeDepth.start({});
+		ScopeBeam<ScopeGlobalConfig> scopeGlobal;
+		scopeGlobal.start({});
+
+		const std::vector<int> scopeExpected{ 1, 3, 30 };
+		ASSERT_EQ(scopeExpected, scopeExpand.getResultList());
+		ASSERT_EQ(scopeExpected, scopeDepth.getResultList());
+		ASSERT_EQ(scopeExpected, scopeGlobal.getResultList());
+
+		// Expand: l2ƒႢXRA̒l3XLbv
+		ASSERT_EQ(2, scopeExpand.getStats().total().skipped);
+		// Depth: l3͗\񎞂ɓAO̐[x̒l2̂݃XLbv
+		ASSERT_EQ(1, scopeDepth.getStats().total().skipped);
+		// Global: l2\񎞂ɏ
+		ASSERT_EQ(0, scopeGlobal.getStats().total().skipped);
+		forange(depth, 3) {
+			ASSERT_EQ(scopeExpand.getStats().getDepths()[depth].accepted, scopeGlobal.getStats().getDepths()[depth].accepted);
+		}
+
+		// em[h̓WJłd_̌Ŗ߂
+		struct ScopeGroupedConfig : public ScopeConfig {
+			NODISCARD inline static constexpr bool UseGroupedExpansion() noexcept { return true; }
+		};
+		ScopeBeam<ScopeGroupedConfig> scopeGrouped;
+		scopeGrouped.start({});
+
+		ASSERT_EQ(scopeExpected, scopeGrouped.getResultList());
+		ASSERT_EQ(2, scopeGrouped.getStats().total().skipped);
+		forange(depth, 3) {
+			ASSERT_EQ(scopeExpand.getStats().getDepths()[depth].accepted, scopeGrouped.getStats().getDepths()[depth].accepted);
+		}
+
+		// ␔𐧌ꍇ́Aǂ̓WJWidtĥdȂ̂ݓWJ
+		struct ScopeBoundedConfig : public ScopeConfig {
+			NODISCARD inline static constexpr bool UseBoundedRanking() noexcept { return true; }
+		};
+		struct ScopeGroupedBoundedConfig : public ScopeGroupedConfig {
+			NODISCARD inline static constexpr bool UseBoundedRanking() noexcept { return true; }
+		};
+		ScopeBeam<ScopeBoundedConfig> scopeBounded;
+		scopeBounded.start({});
+		ScopeBeam<ScopeGroupedBoundedConfig> scopeGroupedBounded;
+		scopeGroupedBounded.start({});
+
+		ASSERT_EQ(scopeBounded.getResultList(), scopeGroupedBounded.getResultList());
+		forange(depth, 3) {
+			ASSERT_EQ(scopeBounded.getStats().getDepths()[depth].accepted, scopeGroupedBounded.getStats().getDepths()[depth].accepted);
+		}
+	}
+
+	/**
+	 * @brief oPbg̔rp̒T
+	 * @details 100̌n͏̃XRAA100ȏ̌n񂪍ŏIIɏ
+	 * @tparam Config
+	*/
+	template<class Config>
+	class BucketBeam : public alib::Search::BeamSearchTemplate<Config, BucketBeam<Config>> {
+	public:
+		using base = alib::Search::BeamSearchTemplate<Config, BucketBeam<Config>>;
+		using SearchMethod = typename base::SearchMethod;
+
+		void init(const SearchMethod&) noexcept override {
+			forange_type(int, i, 5) {
+				this->nextSearch(10 + i, i, i);
+			}
+			this->nextSearch(0, 100, 100);
+		}
+
+		void search(const SearchMethod& arg) noexcept override {
+			forange_type(int, i, 3) {
+				if (100 <= arg.argument) {
+					this->nextSearch(arg.score + 100 + i, arg.hash * 10 + i, 100 + i);
+				}
+				else {
+					this->nextSearch(arg.score + i, arg.hash * 10 + i, i);
+				}
+			}
+		}
+
+	};
+
+	/**
+	 * @brief oPbg̏̋@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, BeamSearch_FuncTest06) {
+
+		using Method = alib::Search::DefaultSearchMethod<int, int, size_t>;
+		using BaseConfig = alib::Search::ConfigTemplate<3, 3, 2000 * 1000, Method>;
+		struct BucketConfig : public BaseConfig {
+			NODISCARD inline static constexpr alib::Search::size_type GetBucketCapacity() noexcept { return 1; }
+			NODISCARD inline static constexpr alib::Search::size_type GetBucket(const Method& method) noexcept { return method.argument / 100; }
+		};
+		struct GroupedConfig : public BucketConfig {
+			NODISCARD inline static constexpr bool UseGroupedExpansion() noexcept { return true; }
+		};
+
+		BucketBeam<BaseConfig> beam;
+		beam.start({});
+		BucketBeam<BucketConfig> bucket;
+		bucket.start({});
+		BucketBeam<GroupedConfig> grouped;
+		grouped.start({});
+
+		// ꍇ͏̃XRAnŃr[܂
+		ASSERT_EQ(4, beam.getResultList()[0]);
+
+		const std::vector<int> expected{ 100, 102, 102 };
+		ASSERT_EQ(expected, bucket.getResultList());
+		ASSERT_EQ(expected, grouped.getResultList());
+	}
+
+	/**
+	 * @brief rʂƒT󋵂̒ʒm̋@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, BeamSearch_FuncTest07) {
+
+		using Method = alib::Search::DefaultSearchMethod<int, int, size_t>;
+		using Config = alib::Search::ConfigTemplate<6, 20, 2000 * 1000, Method>;
+
+		OrderedBeam<Config> beam;
+		std::vector<alib::Search::SearchProgress<Config>> progress;
+		beam.setProgressCallback([&](const alib::Search::SearchProgress<Config>& p) {
+			progress.push_back(p);
+			// rʂ͒ʒm_̍ŗǂ̌܂ł̈
+			const auto best = beam.getBestResult();
+			EXPECT_EQ(p.depth, best.args.size());
+			EXPECT_EQ(p.bestScore, best.score);
+			return true;
+		});
+		beam.start({});
+
+		// ԂƊe[x̌
+		ASSERT_EQ(7, progress.size());
+		forange(idx, progress.size()) {
+			ASSERT_EQ(idx, progress[idx].depth);
+			ASSERT_LT(0, progress[idx].frontier);
+		}
+		const auto complete = beam.getBestResult();
+		ASSERT_TRUE(complete.complete);
+		ASSERT_EQ(54, complete.score);
+		ASSERT_EQ(complete.args, beam.getResultList());
+
+		// ʒm悪falseԂꍇ͓rʂŏI
+		beam.setProgressCallback([](const alib::Search::SearchProgress<Config>& p) {
+			return p.depth < 3;
+		});
+		beam.start({});
+		const auto partial = beam.getBestResult();
+		ASSERT_FALSE(partial.complete);
+		ASSERT_EQ(3, partial.args.size());
+		ASSERT_EQ(27, partial.score);
+		ASSERT_EQ(partial.args, beam.getResultList());
+
+		// I̗v
+		beam.setProgressCallback([&](const alib::Search::SearchProgress<Config>& p) {
+			if (p.depth == 2) {
+				beam.requestStop();
+			}
+			return true;
+		});
+		beam.start({});
+		ASSERT_EQ(2, beam.getResultList().size());
+
+		// TɕʃXbhǂݏo
+		alib::Search::SearchResult<Config> observed;
+		std::thread reader;
+		beam.setProgressCallback([&](const alib::Search::SearchProgress<Config>& p) {
+			if (p.depth == 2) {
+				reader = std::thread([&] { observed = beam.getBestResult(); });
+			}
+			return true;
+		});
+		beam.start({});
+		reader.join();
+		// ǂݏoȍ~̐[x̐؂ւ_̌
+		ASSERT_LE(2, observed.args.size());
+		ASSERT_EQ(9 * static_cast<int>(observed.args.size()), observed.score);
+		ASSERT_EQ(54, beam.getBestResult().score);
+	}
+
+	/**
+	 * @brief v̋@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, BeamSearch_FuncTest08) {
+
+		using Method = alib::Search::DefaultSearchMethod<int, int, size_t>;
+		using Config = alib::Search::ConfigTemplate<6, 20, 2000 * 1000, Method, true>;
+		using ReleaseConfig = alib::Search::ConfigTemplate<6, 20, 2000 * 1000, Method>;
+
+		// ̏ꍇ͉Ȃ
+		ASSERT_TRUE(std::is_empty_v<std::decay_t<decltype(OrderedBeam<ReleaseConfig>().getStats())>>);
+
+		OrderedBeam<Config> beam;
+		beam.start({});
+		const auto& stats = beam.getStats();
+		const auto& depths = stats.getDepths();
+
+		// ̃p^[̐Ɗe[x
+		ASSERT_EQ(6, depths.size());
+		ASSERT_EQ(1, depths[0].accepted);
+		ASSERT_EQ(11, depths[0].reserved);
+		forstep(depth, 1, depths.size()) {
+			ASSERT_EQ(depths[depth].accepted * 10, depths[depth].reserved);
+			ASSERT_LE(depths[depth].accepted + depths[depth].skipped, 20);
+			ASSERT_LT(0, depths[depth].committedBytes);
+			ASSERT_LE(depths[depth].searchTime, depths[depth].totalTime);
+		}
+
+		const auto total = stats.total();
+		ASSERT_EQ(beam.getTransitionCounter().undo, total.undo);
+		ASSERT_EQ(beam.getTransitionCounter().redo, total.redo);
+		ASSERT_LE(0, total.overheadTime());
+	}
+
+	/**
+	 * @brief z֐oRȂĂяő@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, BeamSearch_FuncTest09) {
+
+		using Method = alib::Search::DefaultSearchMethod<int, int, size_t>;
+		using Config = alib::Search::ConfigTemplate<6, 20, 2000 * 1000, Method>;
+
+		// final̒TԂ̂ݐÓIɌĂяo
+		ASSERT_TRUE((alib::Search::Lib::IsStaticDispatchable<OrderedBeam<Config>, OrderedBeam<Config>::base, Method>::value));
+		ASSERT_FALSE((alib::Search::Lib::IsStaticDispatchable<DedupeBeam<Config>, DedupeBeam<Config>::base, Method>::value));
+
+		class Derived final : public DedupeBeam<Config> {
+		public:
+			alib::Search::size_type count = 0;
+			void search(const SearchMethod& arg) noexcept override {
+				count++;
+				DedupeBeam<Config>::search(arg);
+			}
+		};
+
+		// hNXōĒ`ꂽTĂяo邱
+		Derived derived;
+		derived.start({});
+		ASSERT_LT(0, derived.count);
+
+		OrderedBeam<Config> beam;
+		beam.start({});
+		const std::vector<int> expected(6, 9);
+		ASSERT_EQ(expected, beam.getResultList());
+	}
+
+	/**
+	 * @brief тɂ鎞Ԕz̋@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, BeamSearch_FuncTest10) {
+
+		using Method = alib::Search::DefaultSearchMethod<int, int, size_t>;
+		struct Config : public alib::Search::ConfigTemplate<6, 5, 2000, Method, true> {
+			using TimeSchedule = alib::Search::Lib::AdaptiveTimeSchedule<>;
+		};
+
+		OrderedBeam<Config> beam;
+		beam.start({});
+		const std::vector<int> expected(6, 9);
+		ASSERT_EQ(expected, beam.getResultList());
+
+		// Ԃɗ]TꍇWidth𒴂ēWJ
+		const auto& depths = beam.getStats().getDepths();
+		ASSERT_LT(5, depths.back().accepted);
+	}
+
+	/**
+	 * @brief Ԕzŋ߂[x̔rp̒T
+	 * @details ̃XRAႢn̎qłXRAAem[h̓WJƃXRAvȂ
+	 * @tparam Config
+	*/
+	template<class Config>
+	class NarrowBeam final : public alib::Search::BeamSearchTemplate<Config, NarrowBeam<Config>> {
+	public:
+		using base = alib::Search::BeamSearchTemplate<Config, NarrowBeam<Config>>;
+		using SearchMethod = typename base::SearchMethod;
+
+		void init(const SearchMethod&) noexcept override {
+			forange_type(int, i, 3) {
+				this->nextSearch(10 - i, i + 1, i);
+			}
+		}
+
+		void search(const SearchMethod& arg) noexcept override {
+			if (arg.argument < 10) {
+				this->nextSearch(arg.score + (arg.argument == 2 ? 100 : 0), arg.hash * 100 + 10 + arg.argument, 10 + arg.argument);
+			}
+			else {
+				this->nextSearch(arg.score, arg.hash * 100 + 7, 7);
+			}
+		}
+
+	};
+
+	/**
+	 * @brief Ԕzŋ߂[x̐em[h̓WJ̋@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, BeamSearch_FuncTest16) {
+
+		// 2[xڂ̂ݓWJ1ɂ
+		struct NarrowSchedule : public alib::Search::Lib::EvenTimeSchedule {
+			NODISCARD alib::Search::Lib::TimePlan next(const double interval, const int remainDepth, const alib::Search::size_type width, const alib::Search::size_type maxWidth) const noexcept {
+				auto plan = EvenTimeSchedule::next(interval, remainDepth, width, maxWidth);
+				if (remainDepth == 1) {
+					plan.width = 1;
+				}
+				return plan;
+			}
+		};
+
+		using Method = alib::Search::DefaultSearchMethod<int, int, size_t>;
+		struct DefaultConfig : public alib::Search::ConfigTemplate<3, 3, 2000 * 1000, Method> {
+			using TimeSchedule = NarrowSchedule;
+		};
+		struct GroupedConfig : public DefaultConfig {
+			NODISCARD inline static constexpr bool UseGroupedExpansion() noexcept { return true; }
+		};
+		struct GroupedBoundedConfig : public GroupedConfig {
+			NODISCARD inline static constexpr bool UseBoundedRanking() noexcept { return true; }
+		};
+
+		NarrowBeam<DefaultConfig> beam;
+		beam.start({});
+		NarrowBeam<GroupedConfig> grouped;
+		grouped.start({});
+		NarrowBeam<GroupedBoundedConfig> bounded;
+		bounded.start({});
+
+		// ߂[xłem[h̓WJł͂ȂXRȀʂWJ
+		const std::vector<int> expected{ 2, 12, 7 };
+		ASSERT_EQ(expected, beam.getResultList());
+		ASSERT_EQ(expected, grouped.getResultList());
+		ASSERT_EQ(expected, bounded.getResultList());
+	}
+
+	/**
+	 * @brief [xƂ̃r[̋@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, BeamSearch_FuncTest11) {
+
+		using Method = alib::Search::DefaultSearchMethod<int, int, size_t>;
+		struct Config : public alib::Search::ConfigTemplate<6, 20, 2000 * 1000, Method, true> {
+			NODISCARD inline static constexpr alib::Search::size_type GetDepthWidth(const alib::Search::size_type depth) noexcept {
+				constexpr alib::Search::size_type widths[] = { 4, 8, 12, 16, 20, 20 };
+				return widths[depth];
+			}
+		};
+		struct BoundedConfig : public Config {
+			NODISCARD inline static constexpr bool UseBoundedRanking() noexcept { return true; }
+		};
+
+		OrderedBeam<Config> beam;
+		beam.start({});
+		OrderedBeam<BoundedConfig> bounded;
+		bounded.start({});
+		ASSERT_EQ(6, beam.getResultList().size());
+		ASSERT_EQ(beam.getResultList(), bounded.getResultList());
+
+		// [x0initŗ\񂳂ꂽŁAȍ~͐[xƂ̓WJ܂œWJ
+		const auto& depths = beam.getStats().getDepths();
+		const auto& boundedDepths = bounded.getStats().getDepths();
+		ASSERT_EQ(6, depths.size());
+		forstep(depth, 1, depths.size()) {
+			ASSERT_EQ(Config::GetDepthWidth(depth - 1), depths[depth].accepted);
+			ASSERT_EQ(Config::GetDepthWidth(depth - 1), boundedDepths[depth].accepted);
+		}
+	}
+
+	/**
+	 * @brief s̒Tp[^̋@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, BeamSearch_FuncTest12) {
+
+		using Method = alib::Search::DefaultSearchMethod<int, int, size_t>;
+		using Config = alib::Search::ConfigTemplate<6, 20, 2000 * 1000, Method, true>;
+		struct RuntimeConfig : public Config {
+			NODISCARD inline static constexpr bool UseRuntimeParameters() noexcept { return true; }
+		};
+
+		OrderedBeam<Config> beam;
+		beam.start({});
+		OrderedBeam<RuntimeConfig> runtime;
+
+		// l̓ev[gŁA萔̏ꍇƓTɂȂ
+		const auto defaults = runtime.getParameters();
+		ASSERT_EQ(6, defaults.depth);
+		ASSERT_EQ(20, defaults.width);
+		runtime.start({});
+		ASSERT_EQ(beam.getResultList(), runtime.getResultList());
+		ASSERT_EQ(beam.getTransitionCounter().undo, runtime.getTransitionCounter().undo);
+		ASSERT_EQ(beam.getTransitionCounter().redo, runtime.getTransitionCounter().redo);
+
+		// ărhɐ[xƃr[ς
+		runtime.setParameters({ 4, 5, 2000 * 1000 });
+		runtime.start({});
+		const std::vector<int> expected(4, 9);
+		ASSERT_EQ(expected, runtime.getResultList());
+
+		const auto& depths = runtime.getStats().getDepths();
+		ASSERT_EQ(4, depths.size());
+		forstep(depth, 1, depths.size()) {
+			ASSERT_EQ(5, depths[depth].accepted);
+		}
+	}
+
+	/**
+	 * @brief Ԃ̔̕rp̒T
+	 * @details L^l̏Ԃɂ܂Ƃ߁Aݒɂ炸Ԃ̗̈o^
+	 * @tparam Config
+	*/
+	template<class Config>
+	class StateBeam final : public alib::Search::BeamSearchTemplate<Config, StateBeam<Config>> {
+	public:
+		using base = alib::Search::BeamSearchTemplate<Config, StateBeam<Config>>;
+		using SearchMethod = typename base::SearchMethod;
+		// ԑŜ̕ł͏݂L^Ȃ
+		using Reference = alib::Search::MemoType<StateBeam<Config>, Config>;
+
+	private:
+
+		struct State {
+			typename Reference::template Array<typename Reference::template Value<int>, 60> list;
+			typename Reference::template Value<int> total;
+		};
+		State state;
+
+	public:
+
+		StateBeam() {
+			this->setSearchState(state);
+		}
+
+		void init(const SearchMethod&) noexcept override {
+			forange_type(int, i, 10) {
+				this->nextSearch(i, i, i);
+			}
+		}
+
+		void search(const SearchMethod& arg) noexcept override {
+			const auto depth = this->getDepth();
+			state.list[depth] = arg.argument;
+			state.total = state.total + arg.argument;
+
+			// ԂTm[hƈvĂ邱
+			EXPECT_EQ(arg.score, state.total.load());
+
+			forange_type(int, i, 10) {
+				const int v = (i * 3 + arg.argument * 7) % 10;
+				this->nextSearch(arg.score + v, arg.hash * 31 + v, v);
+			}
+		}
+
+	};
+
+	/**
+	 * @brief `FbN|Cg̏ԑJڂ̋@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, BeamSearch_FuncTest13) {
+
+		using Method = alib::Search::DefaultSearchMethod<int, int, size_t>;
+		using Config = alib::Search::ConfigTemplate<60, 20, 2000 * 1000, Method>;
+		struct CheckpointConfig : public Config {
+			NODISCARD inline static constexpr size_t GetCheckpointInterval() noexcept { return 8; }
+			NODISCARD inline static constexpr size_t GetCheckpointBytes() noexcept { return 256; }
+		};
+
+		StateBeam<Config> plain;
+		plain.start({});
+		StateBeam<CheckpointConfig> checkpoint;
+		checkpoint.start({});
+
+		ASSERT_EQ(plain.getResultList(), checkpoint.getResultList());
+		ASSERT_EQ(0, plain.getTransitionCounter().restore);
+		ASSERT_LT(0, checkpoint.getTransitionCounter().restore);
+		ASSERT_GT(plain.getTransitionCounter().redo, checkpoint.getTransitionCounter().redo);
+	}
+
+	/**
+	 * @brief ԑŜ̋̕@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, BeamSearch_FuncTest14) {
+
+		using Method = alib::Search::DefaultSearchMethod<int, int, size_t>;
+		using Config = alib::Search::ConfigTemplate<60, 20, 2000 * 1000, Method>;
+		struct CopyConfig : public Config {
+			NODISCARD inline static constexpr bool UseStateCopy() noexcept { return true; }
+		};
+
+		StateBeam<Config> plain;
+		plain.start({});
+		StateBeam<CopyConfig> copy;
+		copy.start({});
+
+		// TԂœTɂȂApb`͓KpȂ
+		ASSERT_EQ(plain.getResultList(), copy.getResultList());
+		ASSERT_EQ(0, copy.getTransitionCounter().undo);
+		ASSERT_EQ(0, copy.getTransitionCounter().redo);
+		ASSERT_LT(0, copy.getTransitionCounter().restore);
+	}
+
+	/**
+	 * @brief Ԃo^ȂԑŜ̋̕@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, BeamSearch_FuncTest18) {
+
+		using Method = alib::Search::DefaultSearchMethod<int, int, size_t>;
+		struct Config : public alib::Search::ConfigTemplate<5, 10, 2000 * 1000, Method> {
+			NODISCARD inline static constexpr bool UseStateCopy() noexcept { return true; }
+		};
+
+		class Beam final : public alib::Search::BeamSearchTemplate<Config, Beam> {
+		public:
+			using base = alib::Search::BeamSearchTemplate<Config, Beam>;
+			using SearchMethod = base::SearchMethod;
+			using Reference = alib::Search::MemoType<Beam, Config>;
+
+		private:
+
+			Reference::Value<int> total;
+
+		public:
+
+			void init(const SearchMethod&) override {
+				forange_type(int, i, 10) {
+					nextSearch(i, i, i);
+				}
+			}
+
+			void search(const SearchMethod& arg) override {
+				total = total + arg.argument;
+				forange_type(int, i, 10) {
+					nextSearch(arg.score + i, arg.hash * 10 + i, i);
+				}
+			}
+
+		};
+		static_assert(Beam::Reference::StateCopy);
+
+		// ̈悪ꍇ͒Tn߂Ȃ
+		Beam beam;
+		ASSERT_THROW(beam.start({}), std::logic_error);
+	}
+
+	/**
+	 * @brief TԂ̌^̕sT̋@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, BeamSearch_FuncTest15) {
+
+		using Method = alib::Search::DefaultSearchMethod<int, int, size_t>;
+		using Config = alib::Search::ConfigTemplate<60, 20, 2000 * 1000, Method>;
+
+		StateBeam<Config> expected;
+		expected.start({});
+
+		// TƂMemoɋL^邽߁AʃXbh̒T݂̍Ȃ
+		std::array<StateBeam<Config>, 4> beams;
+		std::vector<std::thread> threads;
+		for (auto& beam : beams) {
+			threads.emplace_back([&beam] { beam.start({}); });
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+		for (const auto& beam : beams) {
+			ASSERT_EQ(expected.getResultList(), beam.getResultList());
+			ASSERT_EQ(expected.getTransitionCounter().redo, beam.getTransitionCounter().redo);
+		}
+	}
+
+	/**
+	 * @brief T̗Ő@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, BeamSearch_FuncTest17) {
+
+		using Method = alib::Search::DefaultSearchMethod<int, int, size_t>;
+		using Config = alib::Search::ConfigTemplate<5, 10, 2000 * 1000, Method>;
+
+		class Beam final : public alib::Search::BeamSearchTemplate<Config, Beam> {
+		public:
+			using base = alib::Search::BeamSearchTemplate<Config, Beam>;
+			using SearchMethod = base::SearchMethod;
+			using Reference = alib::Search::MemoType<Beam>;
+
+			bool fail = true;
+
+		private:
+
+			Reference::Value<int> total;
+
+		public:
+
+			void init(const SearchMethod&) override {
+				forange_type(int, i, 10) {
+					nextSearch(i, i + 1, i);
+				}
+			}
+
+			void search(const SearchMethod& arg) override {
+				total = total + arg.argument;
+				if (fail && getDepth() == 2) {
+					throw std::runtime_error("search");
+				}
+				forange_type(int, i, 10) {
+					nextSearch(arg.score + i, arg.hash * 10 + i, i);
+				}
+			}
+
+		};
+
+		using IMemo = alib::Search::Lib::MemoSingleton<Beam>;
+		const auto* shared = std::addressof(IMemo::Get());
+
+		Beam beam;
+		ASSERT_THROW(beam.start({}), std::runtime_error);
+		// jTMemooChꂽ܂܎cȂ
+		ASSERT_EQ(shared, std::addressof(IMemo::Get()));
+
+		beam.fail = false;
+		beam.start({});
+		ASSERT_EQ(5, beam.getResultList().size());
+		ASSERT_EQ(shared, std::addressof(IMemo::Get()));
+	}
+
+	/**
+	 * @brief IC[cA[̒T̋@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, EulerTourBeamSearch_FuncTest01) {
+
+		using Method = alib::Search::DefaultSearchMethod<int, int, size_t>;
+		using Config = alib::Search::ConfigTemplate<200, 20, 2000 * 1000, Method>;
+
+		class Beam : public alib::Search::EulerTourBeamSearchTemplate<Config, Beam> {
+		public:
+			using base = alib::Search::EulerTourBeamSearchTemplate<Config, Beam>;
+			using SearchMethod = base::SearchMethod;
+			using Reference = alib::Search::MemoType<Beam>;
+
+		private:
+
+			Reference::Array<Reference::Value<int>, 200> list;
+			Reference::Value<int> total;
+
+		public:
+
+			void init(const SearchMethod&) noexcept override {
+				forange_type(int, i, 10) {
+					nextSearch(i, i, i);
+				}
+			}
+
+			void search(const SearchMethod& arg) noexcept override {
+				const auto depth = getDepth();
+				list[depth] = arg.argument;
+				total = total + arg.argument;
+
+				// ԂTm[hƈvĂ邱
+				EXPECT_EQ(arg.score, total.load());
+
+				// eƂɎq̃XRA̕тςāAʂ̌𕡐̐eɎU炷
+				forange_type(int, i, 10) {
+					const int v = (i * 3 + arg.argument * 7) % 10;
+					nextSearch(arg.score + v, arg.hash * 31 + v, v);
+				}
+			}
+
+		};
+
+		Beam beam;
+		forange(loop, 2) {
+			beam.start({});
+			const auto result = beam.getResultList();
+
+			ASSERT_EQ(200, result.size());
+			for (const auto& arg : result) {
+				ASSERT_EQ(9, arg);
+			}
+		}
+	}
+
+	/**
+	 * @brief [T̔rp̒T
+	 * @details ƃnbVXRA߁A_̌Ȃ
+	 * @tparam Config
+	 * @tparam Template T̊NX
+	*/
+	template<class Config, template<class, class> class Template>
+	class DeepBeam final : public Template<Config, DeepBeam<Config, Template>> {
+	public:
+		using base = Template<Config, DeepBeam<Config, Template>>;
+		using SearchMethod = typename base::SearchMethod;
+		using Reference = alib::Search::MemoType<DeepBeam<Config, Template>>;
+
+	private:
+
+		typename Reference::template Array<typename Reference::template Value<int>, Config::GetDepth()> list;
+		typename Reference::template Value<int> score;
+
+		NODISCARD static int gain(const int argument, const size_t hash) noexcept {
+			return argument * 1000 + static_cast<int>((hash >> 3) % 997);
+		}
+
+	public:
+
+		void init(const SearchMethod&) noexcept override {
+			forange_type(int, i, 10) {
+				this->nextSearch(gain(i, i), i, i);
+			}
+		}
+
+		void search(const SearchMethod& arg) noexcept override {
+			list[this->getDepth()] = arg.argument;
+			score = score + gain(arg.argument, arg.hash);
+
+			// ԂTm[hƈvĂ邱
+			EXPECT_EQ(arg.score, score.load());
+
+			forange_type(int, i, 10) {
+				const int v = (i * 3 + arg.argument * 7 + this->getDepth()) % 10;
+				const size_t hash = arg.hash * 31 + v;
+				this->nextSearch(arg.score + gain(v, hash), hash, v);
+			}
+		}
+
+	};
+
+	/**
+	 * @brief IC[cA[̐[T̋@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, EulerTourBeamSearch_FuncTest02) {
+
+		using Method = alib::Search::DefaultSearchMethod<int, int, size_t>;
+		using Config = alib::Search::ConfigTemplate<1200, 10, 2000 * 1000, Method>;
+
+		DeepBeam<Config, alib::Search::BeamSearchTemplate> beam;
+		beam.start({});
+		DeepBeam<Config, alib::Search::EulerTourBeamSearchTemplate> euler;
+		euler.start({});
+
+		const auto expected = beam.getResultList();
+		ASSERT_EQ(1200, expected.size());
+		ASSERT_EQ(expected, euler.getResultList());
+	}
+
+	/**
+	 * @brief T̋@\eXg
+	*/
+	TEST(SearcComponent_BeamSearch, ParallelBeamSearch_FuncTest01) {
+
+		struct Arg {
+			Arg() {}
+			Arg(const int v) : value(v) {}
+			int value{};
+		};
+
+		using Method = alib::Search::DefaultSearchMethod<Arg, int, size_t>;
+		struct Config : public alib::Search::ConfigTemplate<5, 100, 2000 * 1000, Method> {
+			NODISCARD inline static constexpr alib::Search::size_type GetThreads() noexcept { return 4; }
+		};
+
+		class Beam : public alib::Search::ParallelBeamSearchTemplate<Config, Beam> {
+		public:
+			using base = alib::Search::ParallelBeamSearchTemplate<Config, Beam>;
+			using SearchMethod = base::SearchMethod;
+			using Reference = alib::Search::MemoType<Beam>;
+
+		private:
+
+			Reference::Array<Reference::Value<int>, 5> list;
+			Reference::Value<int> total;
+
+		public:
+
+			void init(const SearchMethod&) noexcept override {
+				forange_type(int, i, 10) {
+					nextSearch(i, i, i);
+				}
+			}
+
+			void search(const SearchMethod& arg) noexcept override {
+				const auto depth = getDepth();
+				list[depth] = arg.argument.value;
+				total = total + arg.argument.value;
+
+				// e[J[̏ԂTm[hƈvĂ邱
+				EXPECT_EQ(arg.score, total.load());
+
+				forange_type(int, i, 10) {
+					nextSearch(arg.score + i, arg.hash * 10 + i, i);
+				}
+			}
+
+		};
+
+		Beam beam;
+		forange(loop, 2) {
+			beam.start({});
+			const auto result = beam.getResultList();
+
+			ASSERT_EQ(5, result.size());
+			for (const auto& arg : result) {
+				ASSERT_EQ(9, arg.value);
+			}
+		}
+	}
+
+	/**
+	 * @brief T̃[J[͒T܂ŕێATԂ̏Ԃ̂ݎʂ
+	*/
+	TEST(SearcComponent_BeamSearch, ParallelBeamSearch_FuncTest02) {
+
+		using Method = alib::Search::DefaultSearchMethod<int, int, size_t>;
+		struct Config : public alib::Search::ConfigTemplate<4, 50, 2000 * 1000, Method> {
+			NODISCARD inline static constexpr alib::Search::size_type GetThreads() noexcept { return 3; }
+		};
+
+		class Beam : public alib::Search::ParallelBeamSearchTemplate<Config, Beam> {
+		public:
+			using base = alib::Search::ParallelBeamSearchTemplate<Config, Beam>;
+			using SearchMethod = base::SearchMethod;
+			using Reference = alib::Search::MemoType<Beam>;
+
+		private:
+
+			Reference::Value<int> total;
+
+		public:
+
+			/** @brief 񐔂̋L^ */
+			int* copies = nullptr;
+			/** @brief T̑OɕύXliMemoŋL^Ȃj */
+			int bias = 0;
+
+			Beam() = default;
+			Beam(const Beam& o) : base(o), total(o.total), copies(o.copies), bias(o.bias) {
+				(*copies)++;
+			}
+			Beam& operator=(const Beam&) = default;
+
+			void init(const SearchMethod&) noexcept override {
+				forange_type(int, i, 10) {
+					nextSearch(bias + i, i, i);
+				}
+			}
+
+			void search(const SearchMethod& arg) noexcept override {
+				total = total + arg.argument;
+
+				// e[J[̒TԂɒTO̕ύXʂĂ邱
+				EXPECT_EQ(arg.score, bias + total.load());
+
+				forange_type(int, i, 10) {
+					nextSearch(arg.score + i, arg.hash * 10 + i, i);
+				}
+			}
+
+		};
+
+		int copies = 0;
+		Beam beam;
+		beam.copies = std::addressof(copies);
+		forange_type(int, loop, 3) {
+			beam.bias = loop * 1000;
+			beam.start({});
+			const auto result = beam.getResultList();
+
+			ASSERT_EQ(4, result.size());
+			for (const auto& arg : result) {
+				ASSERT_EQ(9, arg);
+			}
+		}
+		ASSERT_EQ(2, copies);
+	}
+
 }
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "../pch.h"
 
+#include <array>
 #include <vector>
 #include <memory>
 
@@ -76,7 +77,9 @@ namespace SearcComponent::BufferTest {
 		buffer.modify(std::addressof(b), sizeof(b));
 		b = 30.3;
 
-		const size_t modifySize = calcSize<decltype(a)>() + calcSize<decltype(a)>() + calcSize<decltype(b)>() + calcSize<decltype(b)>();
+		// AhXւ̕ύX͍ŏ̋L^̂ݎcA2ڈȍ~̋L^̓AhX̑ɂ
+		using Offset = decltype(buffer)::OffsetType;
+		const size_t modifySize = calcSize<decltype(a)>() + calcSize<decltype(b)>() - (sizeof(void*) - sizeof(Offset));
 		EXPECT_EQ(buffer.wholeSize(), modifySize);
 
 		std::vector<std::byte> data(buffer.wholeSize());
@@ -90,19 +93,6 @@ namespace SearcComponent::BufferTest {
 			const auto p = std::addressof(b);
 			using value_type = std::decay_t<decltype(*p)>;
 
-			EXPECT_EQ(*reinterpret_cast<value_type**>(std::addressof(data.at(ptr))), p);
-			ptr += sizeof(value_type*);
-			EXPECT_EQ(*reinterpret_cast<size_type*>(std::addressof(data.at(ptr))), sizeof(value_type));
-			ptr += sizeof(size_type);
-			EXPECT_EQ(*reinterpret_cast<value_type*>(std::addressof(data.at(ptr))), 30.3);
-			ptr += sizeof(value_type);
-			EXPECT_EQ(*reinterpret_cast<value_type*>(std::addressof(data.at(ptr))), 20.2);
-			ptr += sizeof(value_type);
-		}
-		{
-			const auto p = std::addressof(b);
-			using value_type = std::decay_t<decltype(*p)>;
-
 			EXPECT_EQ(*reinterpret_cast<value_type**>(std::addressof(data.at(ptr))), p);
 			ptr += sizeof(value_type*);
 			EXPECT_EQ(*reinterpret_cast<size_type*>(std::addressof(data.at(ptr))), sizeof(value_type));
@@ -116,27 +106,87 @@ namespace SearcComponent::BufferTest {
 			const auto p = std::addressof(a);
 			using value_type = std::decay_t<decltype(*p)>;
 
-			EXPECT_EQ(*reinterpret_cast<value_type**>(std::addressof(data.at(ptr))), p);
-			ptr += sizeof(value_type*);
+			const auto offset = reinterpret_cast<std::intptr_t>(p) - reinterpret_cast<std::intptr_t>(std::addressof(b));
+			EXPECT_EQ(*reinterpret_cast<Offset*>(std::addressof(data.at(ptr))), offset);
+			ptr += sizeof(Offset);
 			EXPECT_EQ(*reinterpret_cast<size_type*>(std::addressof(data.at(ptr))), sizeof(value_type));
 			ptr += sizeof(size_type);
 			EXPECT_EQ(*reinterpret_cast<value_type*>(std::addressof(data.at(ptr))), 30);
 			ptr += sizeof(value_type);
-			EXPECT_EQ(*reinterpret_cast<value_type*>(std::addressof(data.at(ptr))), 20);
+			EXPECT_EQ(*reinterpret_cast<value_type*>(std::addressof(data.at(ptr))), 10);
 			ptr += sizeof(value_type);
 		}
-		{
-			const auto p = std::addressof(a);
-			using value_type = std::decay_t<decltype(*p)>;
+	}
 
-			EXPECT_EQ(*reinterpret_cast<value_type**>(std::addressof(data.at(ptr))), p);
-			ptr += sizeof(value_type*);
-			EXPECT_EQ(*reinterpret_cast<size_type*>(std::addressof(data.at(ptr))), sizeof(value_type));
-			ptr += sizeof(size_type);
-			EXPECT_EQ(*reinterpret_cast<value_type*>(std::addressof(data.at(ptr))), 30);
-			ptr += sizeof(value_type);
-			EXPECT_EQ(*reinterpret_cast<value_type*>(std::addressof(data.at(ptr))), 10);
-			ptr += sizeof(value_type);
+	/**
+	 * @brief L^̏W̋@\eXg
+	*/
+	TEST(SearcComponent_Buffer, SearcComponent_Buffer_FuncTest03) {
+
+		using namespace alib::Search::Lib;
+
+		Buffer<1000> buffer;
+		buffer.lock();
+
+		// TCYقȂꍇ͕ʂ̋L^ɂ
+		long long a = 10;
+		buffer.modify(std::addressof(a), sizeof(a));
+		buffer.modify(std::addressof(a), sizeof(int));
+		buffer.modify(std::addressof(a), sizeof(a));
+		a = 20;
+		EXPECT_EQ(buffer.wholeSize(), calcSize<long long>() + calcSize<int>() - (sizeof(void*) - sizeof(decltype(buffer)::OffsetType)));
+
+		std::vector<std::byte> data(buffer.wholeSize());
+		buffer.commit(Stream(data.data(), data.size()));
+		EXPECT_EQ(buffer.wholeSize(), 0);
+
+		// pb`쐬͍ĂыL^
+		buffer.modify(std::addressof(a), sizeof(a));
+		buffer.modify(std::addressof(a), sizeof(a));
+		EXPECT_EQ(buffer.wholeSize(), calcSize<long long>());
+	}
+
+	/**
+	 * @brief obt@Ɏ܂ȂL^̋@\eXg
+	*/
+	TEST(SearcComponent_Buffer, SearcComponent_Buffer_FuncTest04) {
+
+		using namespace alib::Search::Lib;
+
+		Buffer<64> buffer;
+		buffer.lock();
+
+		std::array<int, 100> values{};
+		std::array<std::byte, 200> large{};
+
+		// ǉ̗̈2ڈȍ~̃pb`쐬ōėp
+		forange(loop, 2) {
+			const int base = loop * 1000;
+			for (auto& v : values) {
+				buffer.modify(std::addressof(v), sizeof(v));
+			}
+			// obt@傫ȋL^
+			buffer.modify(large.data(), large.size());
+			forange(idx, values.size()) {
+				values[idx] = base + static_cast<int>(idx) + 1000;
+			}
+			large.fill(std::byte{ static_cast<unsigned char>(loop + 1) });
+
+			std::vector<std::byte> data(buffer.wholeSize());
+			const auto patch = buffer.commit(Stream(data.data(), data.size()));
+			EXPECT_EQ(buffer.wholeSize(), 0);
+
+			patch.undo();
+			forange(idx, values.size()) {
+				ASSERT_EQ(loop == 0 ? 0 : base + static_cast<int>(idx), values[idx]);
+			}
+			ASSERT_EQ(std::byte{ static_cast<unsigned char>(loop) }, large.front());
+
+			patch.redo();
+			forange(idx, values.size()) {
+				ASSERT_EQ(base + static_cast<int>(idx) + 1000, values[idx]);
+			}
+			ASSERT_EQ(std::byte{ static_cast<unsigned char>(loop + 1) }, large.back());
 		}
 	}
 }
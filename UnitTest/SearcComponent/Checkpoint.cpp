@@ -0,0 +1,54 @@
+#include "pch.h"
+#include "../pch.h"
+
+#include "../../CppLib/SearcComponent/Checkpoint.hpp"
+
+namespace SearcComponent::CheckpointTest {
+
+	/**
+	 * @brief P@\eXg
+	*/
+	TEST(SearcComponent_Checkpoint, CheckpointStore_FuncTest01) {
+		using namespace alib::Search::Lib;
+
+		std::array<int, 4> state{ 1, 2, 3, 4 };
+		CheckpointStore checkpoints;
+		ASSERT_FALSE(checkpoints.enabled());
+
+		checkpoints.setRegion(state.data(), sizeof(state));
+		ASSERT_TRUE(checkpoints.enabled());
+		ASSERT_EQ(sizeof(state), checkpoints.size());
+
+		checkpoints.save(1);
+		ASSERT_TRUE(checkpoints.has(1));
+		ASSERT_FALSE(checkpoints.has(2));
+		ASSERT_EQ(0, checkpoints.getBytes(1));
+
+		state = { 5, 6, 7, 8 };
+		checkpoints.save(3);
+		checkpoints.setBytes(2, 12);
+		ASSERT_EQ(12, checkpoints.getBytes(2));
+		ASSERT_FALSE(checkpoints.has(2));
+
+		checkpoints.restore(1);
+		ASSERT_EQ((std::array<int, 4>{ 1, 2, 3, 4 }), state);
+		checkpoints.restore(3);
+		ASSERT_EQ((std::array<int, 4>{ 5, 6, 7, 8 }), state);
+
+		// g͍ėp
+		checkpoints.release(1);
+		ASSERT_FALSE(checkpoints.has(1));
+		state = { 9, 9, 9, 9 };
+		checkpoints.save(4);
+		checkpoints.restore(3);
+		ASSERT_EQ((std::array<int, 4>{ 5, 6, 7, 8 }), state);
+		checkpoints.restore(4);
+		ASSERT_EQ((std::array<int, 4>{ 9, 9, 9, 9 }), state);
+
+		checkpoints.clear();
+		ASSERT_FALSE(checkpoints.has(3));
+		ASSERT_FALSE(checkpoints.has(4));
+		ASSERT_EQ(0, checkpoints.getBytes(2));
+	}
+
+}
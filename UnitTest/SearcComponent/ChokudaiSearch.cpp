@@ -0,0 +1,185 @@
+#include "pch.h"
+#include "../pch.h"
+
+#include "../../CppLib/ChokudaiSearch.hpp"
+
+namespace SearcComponent::ChokudaiSearchTest {
+
+	/**
+	 * @brief P@\eXg
+	*/
+	TEST(SearcComponent_ChokudaiSearch, ChokudaiSearch_FuncTest01) {
+
+		struct Arg {
+			Arg() {}
+			Arg(const int v) : value(v) {}
+			int value{};
+		};
+
+		using Method = alib::Search::DefaultSearchMethod<Arg>;
+		using Config = alib::Search::ConfigTemplate<3, 1, 2000 * 1000, Method>;
+
+		class Chokudai : public alib::Search::ChokudaiSearchTemplate<Config, Chokudai> {
+		public:
+			using base = alib::Search::ChokudaiSearchTemplate<Config, Chokudai>;
+			using SearchMethod = base::SearchMethod;
+			using Reference = alib::Search::MemoType<Chokudai>;
+
+		private:
+
+			Reference::Array<Reference::Value<int>, 3> list;
+
+		public:
+
+			void init(const SearchMethod&) noexcept override {
+				forange_type(int, i, 10) {
+					nextSearch(i, i);
+				}
+			}
+
+			void search(const SearchMethod& arg) noexcept override {
+				const auto depth = getDepth();
+				list[depth] = arg.argument.value;
+
+				// ŏ̐[x0IԂƌォ傫Lт
+				const int bonus = (depth == 0 && arg.argument.value == 0) ? 100 : 0;
+				forange_type(int, i, 10) {
+					nextSearch(arg.score + bonus + i, i);
+				}
+			}
+
+		};
+
+		Chokudai chokudai;
+		chokudai.start({});
+		const auto result = chokudai.getResultList();
+
+		// 1̃r[T[`ł9IԂAJԂƂ0̌oH
+		ASSERT_EQ(3, result.size());
+		ASSERT_EQ(0, result[0].value);
+		ASSERT_EQ(9, result[1].value);
+		ASSERT_EQ(9, result[2].value);
+	}
+
+	/**
+	 * @brief ԂZĂ1ڂ̑͊
+	*/
+	TEST(SearcComponent_ChokudaiSearch, ChokudaiSearch_FuncTest02) {
+
+		struct Arg {
+			Arg() {}
+			Arg(const int v) : value(v) {}
+			int value{};
+		};
+
+		using Method = alib::Search::DefaultSearchMethod<Arg, double, size_t>;
+		using Config = alib::Search::ConfigTemplate<5, 2, 0, Method>;
+
+		class Chokudai : public alib::Search::ChokudaiSearchTemplate<Config, Chokudai> {
+		public:
+			using base = alib::Search::ChokudaiSearchTemplate<Config, Chokudai>;
+			using SearchMethod = base::SearchMethod;
+			using Reference = alib::Search::MemoType<Chokudai>;
+
+		private:
+
+			Reference::Array<Reference::Value<int>, 5> list;
+
+		public:
+
+			void init(const SearchMethod&) noexcept override {
+				forange_type(int, i, 10) {
+					nextSearch(i, i, i);
+				}
+			}
+
+			void search(const SearchMethod& arg) noexcept override {
+				const auto depth = getDepth();
+				list[depth] = arg.argument.value;
+				forange_type(int, i, 10) {
+					nextSearch(arg.score + i, arg.hash * 10 + i, i);
+				}
+			}
+
+		};
+
+		Chokudai chokudai;
+		chokudai.start({});
+		const auto result = chokudai.getResultList();
+
+		ASSERT_EQ(5, result.size());
+		for (const auto& arg : result) {
+			ASSERT_EQ(9, arg.value);
+		}
+	}
+
+	/**
+	 * @brief [xƂ̒Tm[hL[͏ʂ̌ɍi
+	*/
+	TEST(SearcComponent_ChokudaiSearch, ChokudaiSearch_FuncTest03) {
+
+		struct Arg {
+			Arg() {}
+			Arg(const int v) : value(v) {}
+			int value{};
+		};
+
+		using Method = alib::Search::DefaultSearchMethod<Arg>;
+		struct Config : public alib::Search::ConfigTemplate<3, 1, 2000 * 1000, Method> {
+			NODISCARD inline static constexpr alib::Search::size_type GetQueueCapacity() noexcept { return 2; }
+		};
+
+		class Chokudai : public alib::Search::ChokudaiSearchTemplate<Config, Chokudai> {
+		public:
+			using base = alib::Search::ChokudaiSearchTemplate<Config, Chokudai>;
+			using SearchMethod = base::SearchMethod;
+			using Reference = alib::Search::MemoType<Chokudai>;
+
+		private:
+
+			Reference::Array<Reference::Value<int>, 3> list;
+
+		public:
+
+			int searchCount = 0;
+
+			void init(const SearchMethod&) noexcept override {
+				forange_type(int, i, 10) {
+					nextSearch(i, i);
+				}
+			}
+
+			void search(const SearchMethod& arg) noexcept override {
+				searchCount++;
+				const auto depth = getDepth();
+				list[depth] = arg.argument.value;
+				forange_type(int, i, 10) {
+					nextSearch(arg.score + i, i);
+				}
+			}
+
+		};
+
+		Chokudai chokudai;
+		chokudai.start({});
+		const auto result = chokudai.getResultList();
+
+		ASSERT_EQ(3, result.size());
+		for (const auto& arg : result) {
+			ASSERT_EQ(9, arg.value);
+		}
+		// iȂꍇ͎ԓɑSm[hi10 + 100jT
+		ASSERT_LT(0, chokudai.searchCount);
+		ASSERT_GE(20, chokudai.searchCount);
+
+		// ĒTĂʂɂȂ
+		chokudai.searchCount = 0;
+		chokudai.start({});
+		const auto again = chokudai.getResultList();
+		ASSERT_EQ(3, again.size());
+		for (const auto& arg : again) {
+			ASSERT_EQ(9, arg.value);
+		}
+	}
+
+}
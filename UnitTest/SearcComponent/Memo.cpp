@@ -1,7 +1,12 @@
 #include "pch.h"
 #include "../pch.h"
 
+#include <algorithm>
 #include <array>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 #include "../../CppLib/Basic.hpp"
 #include "../../CppLib/SearcComponent/Memo.hpp"
@@ -24,6 +29,8 @@ namespace SearcComponent::MemoTest {
 		a = 20;
 
 		const auto patch = memo.commit();
+		// AhXETCYEύXEύXO
+		ASSERT_EQ(sizeof(void*) + sizeof(Memo::MemoSizeType) + sizeof(int) * 2, patch.size());
 
 		patch.undo();
 		ASSERT_EQ(a, 10);
@@ -121,4 +128,204 @@ namespace SearcComponent::MemoTest {
 		memoB.release(patchB);
 		memoC.release(patchC);
 	}
+
+	/**
+	 * @brief lւ̕̕ύX̋@\eXg
+	*/
+	TEST(SearcComponent_Memo, SearcComponent_Memo_FuncTest04) {
+		using namespace alib::Search::Lib;
+
+		struct A {};
+		auto& memo = MemoSingleton<A>::Get();
+		memo.unlock();
+		memo.lock();
+
+		int a = 10;
+		forange(i, 10) {
+			memo.modify(a);
+			a += i;
+		}
+
+		// ŏ̕ύXO̒lƍŌ̒l݂̂L^
+		const auto patch = memo.commit();
+		ASSERT_EQ(sizeof(void*) + sizeof(Memo::MemoSizeType) + sizeof(int) * 2, patch.size());
+
+		patch.undo();
+		ASSERT_EQ(a, 10);
+
+		patch.redo();
+		ASSERT_EQ(a, 55);
+
+		memo.release(patch);
+	}
+
+	/**
+	 * @brief ꂽAhX̋L^̋@\eXg
+	*/
+	TEST(SearcComponent_Memo, SearcComponent_Memo_FuncTest05) {
+		using namespace alib::Search::Lib;
+
+		struct A {};
+		auto& memo = MemoSingleton<A>::Get();
+		memo.unlock();
+		memo.lock();
+
+		// ꂪ32bitɎ܂ꍇ
+		std::array<int, 3> near{ 1, 2, 3 };
+		for (auto& v : near) {
+			memo.modify(v);
+			v *= 10;
+		}
+		const auto nearPatch = memo.commit();
+		ASSERT_EQ(sizeof(void*) + (sizeof(Memo::MemoSizeType) + sizeof(int) * 2) * 3 + sizeof(Memo::PatchType::OffsetType) * 2, nearPatch.size());
+
+		// ꂪ32bitɎ܂Ȃꍇ̓AhX
+		static int far = 4;
+		auto heap = std::make_unique<int>(5);
+		int local = 6;
+		memo.modify(far);
+		memo.modify(*heap);
+		memo.modify(local);
+		far = 40;
+		*heap = 50;
+		local = 60;
+		const auto farPatch = memo.commit();
+
+		nearPatch.undo();
+		farPatch.undo();
+		ASSERT_EQ((std::array<int, 3>{ 1, 2, 3 }), near);
+		ASSERT_EQ(4, far);
+		ASSERT_EQ(5, *heap);
+		ASSERT_EQ(6, local);
+
+		nearPatch.redo();
+		farPatch.redo();
+		ASSERT_EQ((std::array<int, 3>{ 10, 20, 30 }), near);
+		ASSERT_EQ(40, far);
+		ASSERT_EQ(50, *heap);
+		ASSERT_EQ(60, local);
+
+		memo.release(nearPatch);
+		memo.release(farPatch);
+	}
+
+	/**
+	 * @brief XbhƂ̃oCh̋@\eXg
+	*/
+	TEST(SearcComponent_Memo, SearcComponent_Memo_FuncTest06) {
+		using namespace alib::Search::Lib;
+
+		struct A {};
+		Memo& shared = MemoSingleton<A>::Get();
+		Memo local;
+
+		// ؂ւÕCX^XԂ
+		Memo* previous = MemoSingleton<A>::Bind(local);
+		ASSERT_EQ(std::addressof(shared), previous);
+		ASSERT_EQ(std::addressof(local), std::addressof(MemoSingleton<A>::Get()));
+
+		// ʃXbh͊̃CX^X̂܂
+		Memo* other = nullptr;
+		std::thread([&] { other = std::addressof(MemoSingleton<A>::Get()); }).join();
+		ASSERT_EQ(std::addressof(shared), other);
+
+		ASSERT_EQ(std::addressof(local), MemoSingleton<A>::Bind(*previous));
+		ASSERT_EQ(std::addressof(shared), std::addressof(MemoSingleton<A>::Get()));
+	}
+
+	/**
+	 * @brief obt@𒴂ύX̋@\eXg
+	*/
+	TEST(SearcComponent_Memo, SearcComponent_Memo_FuncTest07) {
+		using namespace alib::Search::Lib;
+
+		Memo memo;
+		memo.lock();
+
+		// ՖʑŜ̍XViL^̓obt@̐{ɂȂj
+		auto grid = std::make_unique<std::array<int, 8192>>();
+		forange(idx, grid->size()) {
+			memo.modify((*grid)[idx]);
+			(*grid)[idx] = static_cast<int>(idx) + 1;
+		}
+		const auto patch = memo.commit();
+
+		patch.undo();
+		for (const auto v : *grid) {
+			ASSERT_EQ(0, v);
+		}
+		patch.redo();
+		forange(idx, grid->size()) {
+			ASSERT_EQ(static_cast<int>(idx) + 1, (*grid)[idx]);
+		}
+		memo.release(patch);
+		memo.unlock();
+	}
+
+	/**
+	 * @brief XR[vɂoCh̋@\eXg
+	*/
+	TEST(SearcComponent_Memo, SearcComponent_Memo_FuncTest08) {
+		using namespace alib::Search::Lib;
+
+		struct A {};
+		Memo& shared = MemoSingleton<A>::Get();
+
+		{
+			Memo local;
+			const MemoSingleton<A>::Binding binding(local);
+			ASSERT_EQ(std::addressof(local), std::addressof(MemoSingleton<A>::Get()));
+		}
+		ASSERT_EQ(std::addressof(shared), std::addressof(MemoSingleton<A>::Get()));
+
+		// OŔꍇɖ߂
+		Memo local;
+		try {
+			const MemoSingleton<A>::Binding binding(local);
+			throw std::runtime_error("search");
+		}
+		catch (const std::runtime_error&) {}
+		ASSERT_EQ(std::addressof(shared), std::addressof(MemoSingleton<A>::Get()));
+	}
+
+	/**
+	 * @brief y[W𒴂pb`̋@\eXg
+	*/
+	TEST(SearcComponent_Memo, SearcComponent_Memo_FuncTest09) {
+		using namespace alib::Search::Lib;
+
+		Memo memo;
+		memo.lock();
+
+		// L^1MiB̃y[W𒴂
+		std::vector<int> grid(160 * 1024);
+		forange(idx, grid.size()) {
+			memo.modify(grid[idx]);
+			grid[idx] = static_cast<int>(idx) + 1;
+		}
+		const auto large = memo.commit();
+		ASSERT_LT(1024 * 1024, large.size());
+
+		grid[0] = -1;
+		memo.modify(grid[1]);
+		grid[1] = -2;
+		const auto small = memo.commit();
+
+		small.undo();
+		large.undo();
+		for (const auto v : grid) {
+			ASSERT_EQ(0, v);
+		}
+		large.redo();
+		small.redo();
+		forstep(idx, 2, grid.size()) {
+			ASSERT_EQ(static_cast<int>(idx) + 1, grid[idx]);
+		}
+		ASSERT_EQ(-2, grid[1]);
+
+		std::array<Memo::pointer, 2> patches = { large.address(), small.address() };
+		std::sort(patches.begin(), patches.end());
+		memo.release(patches.begin(), patches.end());
+		memo.unlock();
+	}
 }
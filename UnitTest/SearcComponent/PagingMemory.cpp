@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "../pch.h"
 
+#include <algorithm>
 #include <array>
 
 #include "../../CppLib/SearcComponent/PagingMemory.hpp"
@@ -88,4 +89,88 @@ namespace SearcComponent::PagingMemoryTest {
 		const auto p08 = memory.create(18, 20);
 		ASSERT_EQ(p02, p08);
 	}
+
+	/**
+	 * @brief ܂Ƃ߂ĉ@\eXg
+	*/
+	TEST(SearcComponent_PagingMemory, SearcComponent_PagingMemory_FuncTest03) {
+		using namespace alib::Search::Lib;
+
+		PagingMemory<std::byte, 10> memory;
+
+		const auto p01 = memory.allocate(4);
+		const auto p02 = memory.allocate(4);
+		const auto p03 = memory.allocate(4);
+		const auto p04 = memory.allocate(4);
+		const auto p05 = memory.allocate(4);
+
+		// 2y[WăAhXɕׂ
+		std::array<std::byte*, 3> released = { p03, p01, p02 };
+		std::sort(released.begin(), released.end());
+		memory.release(released.begin(), released.end());
+
+		// Sĉy[Ŵݍėp
+		const auto p06 = memory.allocate(4);
+		const auto p07 = memory.allocate(4);
+		ASSERT_NE(p04, p07);
+		ASSERT_NE(p05, p07);
+		ASSERT_NE(p06, p07);
+		ASSERT_EQ(p01, p07);
+	}
+
+	/**
+	 * @brief y[Wxč쐬@\eXg
+	*/
+	TEST(SearcComponent_PagingMemory, SearcComponent_PagingMemory_FuncTest04) {
+		using namespace alib::Search::Lib;
+
+		PagingMemory<std::byte, 10> memory;
+		ASSERT_EQ(0, memory.pageCount());
+
+		const auto p01 = memory.allocate(6);
+		ASSERT_EQ(1, memory.pageCount());
+		const auto p02 = memory.allocate(6);
+		ASSERT_EQ(2, memory.pageCount());
+
+		// y[Wėp
+		memory.release(p01);
+		const auto p03 = memory.allocate(6);
+		ASSERT_EQ(2, memory.pageCount());
+		ASSERT_EQ(p01, p03);
+		memory.release(p02);
+		memory.release(p03);
+	}
+
+	/**
+	 * @brief y[W𒴂mۂ̋@\eXg
+	*/
+	TEST(SearcComponent_PagingMemory, SearcComponent_PagingMemory_FuncTest05) {
+		using namespace alib::Search::Lib;
+
+		PagingMemory<std::byte, 10> memory;
+
+		const auto p01 = memory.allocate(4);
+		const auto p02 = memory.allocate(25);
+		const auto p03 = memory.allocate(4);
+		const auto p04 = memory.allocate(11);
+		ASSERT_EQ(1, memory.pageCount());
+		ASSERT_EQ(2, memory.blockCount());
+
+		// ʂɊmۂ̈͑Ŝɏ߂
+		std::fill(p02, p02 + 25, std::byte{ 1 });
+		std::fill(p04, p04 + 11, std::byte{ 2 });
+
+		memory.release(p02);
+		ASSERT_EQ(1, memory.blockCount());
+
+		// y[W̊mۂƍĂ܂Ƃ߂ĉ
+		std::array<std::byte*, 3> released = { p01, p03, p04 };
+		std::sort(released.begin(), released.end());
+		memory.release(released.begin(), released.end());
+		ASSERT_EQ(0, memory.blockCount());
+
+		const auto p05 = memory.allocate(4);
+		ASSERT_EQ(p01, p05);
+		memory.release(p05);
+	}
 }
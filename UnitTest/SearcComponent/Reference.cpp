@@ -259,4 +259,32 @@ namespace SearcComponent::ReferenceTest {
 		memo.lock();
 		// TODO
 	}
+
+	/**
+	 * @brief ԑŜ̋̕@\eXg
+	*/
+	TEST(SearcComponent_Memo, Value_FuncTest03) {
+		using namespace alib::Search::Lib;
+		struct Space {};
+		struct Config {
+			NODISCARD inline static constexpr bool UseStateCopy() noexcept { return true; }
+		};
+		static_assert(not alib::Search::MemoType<Space>::StateCopy);
+		static_assert(alib::Search::MemoType<Space, Config>::StateCopy);
+
+		auto& memo = MemoSingleton<Space>::Get();
+		memo.lock();
+
+		// L^ɑ
+		alib::Search::MemoType<Space, Config>::Value<int> value;
+		alib::Search::MemoType<Space, Config>::Vector<int, 4> vector;
+		value = 10;
+		vector.resize(2, 5);
+		ASSERT_EQ(10, value.load());
+		ASSERT_EQ(2, vector.size());
+
+		const auto patch = memo.commit();
+		ASSERT_EQ(0, patch.size());
+		memo.unlock();
+	}
 }
@@ -1,6 +1,8 @@
 #include "pch.h"
 #include "../pch.h"
 
+#include <array>
+
 #include "../../CppLib/SearcComponent/SearchComponentLib.hpp"
 
 namespace SearcComponent::SearchComponentLibTest {
@@ -17,4 +19,24 @@ namespace SearcComponent::SearchComponentLibTest {
 		ASSERT_EQ(1_M, 1024 * 1024);
 		ASSERT_EQ(16_M, 16 * 1024 * 1024);
 	}
-}
\ No newline at end of file
+
+	/**
+	 * @brief P@\eXg
+	*/
+	TEST(SearcComponent_SearchComponentLib, SearcComponent_FuncTest02) {
+		using namespace alib::Search::Lib;
+
+		// Œ蒷ɓWJTCYƂȊÕTCY
+		for (const size_t size : { 1, 2, 3, 4, 8, 12, 16, 24 }) {
+			std::array<unsigned char, 32> src{};
+			std::array<unsigned char, 32> dst{};
+			forange(i, src.size()) {
+				src[i] = static_cast<unsigned char>(i + 1);
+			}
+			CopyBytes(dst.data(), src.data(), size);
+			forange(i, dst.size()) {
+				ASSERT_EQ(i < size ? src[i] : 0, dst[i]);
+			}
+		}
+	}
+}
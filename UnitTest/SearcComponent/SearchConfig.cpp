@@ -123,12 +123,24 @@ namespace SearcComponent::SearchConfigTest {
 		constexpr auto depth = Config::GetDepth();
 		constexpr auto width = Config::GetWidth();
 		constexpr auto limit = Config::GetLimit();
+		constexpr auto bounded = Config::UseBoundedRanking();
+		constexpr auto visited = Config::GetVisitedCapacity();
+		constexpr auto tolerance = Config::GetTimeTolerance();
+		constexpr auto depthWidth = Config::GetDepthWidth(3);
+		constexpr auto runtime = Config::UseRuntimeParameters();
+		constexpr auto stateCopy = Config::UseStateCopy();
 
 		ASSERT_TRUE(hash);
 		ASSERT_FALSE(debug);
+		ASSERT_FALSE(bounded);
+		ASSERT_FALSE(runtime);
+		ASSERT_FALSE(stateCopy);
 
 		ASSERT_EQ(10, depth);
 		ASSERT_EQ(100, width);
 		ASSERT_EQ(2000, limit);
+		ASSERT_EQ(1000, visited);
+		ASSERT_EQ(100, depthWidth);
+		ASSERT_LT(0, tolerance);
 	}
 }
\ No newline at end of file
@@ -38,6 +38,37 @@ namespace SearcComponent::SearchNodeTest {
 		ASSERT_EQ(0, node2.ref);
 	}
 
+	/**
+	 * @brief P@\eXg
+	*/
+	TEST(SearcComponent_SearchCandidate, SearchCandidate_FuncTest01) {
+		using namespace alib::Search;
+		using namespace alib::Search::Lib;
+
+		struct Arg {
+			Arg() {}
+			Arg(int a, double b) :a(a), b(b) {}
+			int a{};
+			double b{};
+		};
+
+		using Method = DefaultSearchMethod<Arg, double, size_t>;
+		using Config = ConfigTemplate<10, 100, 2000, Method>;
+
+		SearchNode<Config> node;
+		SearchCandidate<Config> candidate1(std::addressof(node), Method{ 1,0,Arg{ 1,2.0 } });
+		SearchCandidate<Config> candidate2(std::addressof(node), Method{ 2,0,Arg{ 3,4.0 } });
+
+		// ̍쐬ł͐em[hQƂȂ
+		ASSERT_EQ(1, node.ref);
+		ASSERT_EQ(std::addressof(node), candidate1.parent);
+		ASSERT_EQ(1, candidate1.searchArgument.argument.a);
+
+		ASSERT_TRUE(candidate1 < candidate2);
+		ASSERT_TRUE(candidate2 > candidate1);
+		ASSERT_FALSE(candidate2 < candidate1);
+	}
+
 	/**
 	 * @brief P@\eXg
 	*/
@@ -66,4 +97,49 @@ namespace SearcComponent::SearchNodeTest {
 		ASSERT_EQ(ptr1, ptr2);
 		ASSERT_NE(ptr1, ptr3);
 	}
-}
\ No newline at end of file
+
+	/**
+	 * @brief P@\eXg
+	*/
+	TEST(SearcComponent_CompactNodePool, CompactNodePool_FuncTest01) {
+		using namespace alib::Search;
+		using namespace alib::Search::Lib;
+
+		// TApb`͐擪32bit̃TCYŎ
+		ASSERT_LE(sizeof(CompactSearchNode), 24);
+
+		CompactNodePool<int> pool;
+
+		const auto root = pool.create();
+		ASSERT_NE(0, root);
+		ASSERT_EQ(0, pool.node(root).parent);
+		ASSERT_FALSE(pool.node(root).hasPatch());
+
+		const auto child = pool.create(root, 5);
+		ASSERT_EQ(root, pool.node(child).parent);
+		ASSERT_EQ(1, pool.node(child).depth);
+		ASSERT_EQ(1, pool.node(child).ref);
+		ASSERT_EQ(2, pool.node(root).ref);
+		ASSERT_EQ(5, pool.argument(child));
+
+		std::byte data[8]{};
+		pool.node(child).setPatch(Memo::PatchType(data, data + 8));
+		ASSERT_TRUE(pool.node(child).hasPatch());
+		ASSERT_EQ(8, pool.node(child).patch().size());
+		ASSERT_EQ(data, pool.node(child).patch().address());
+
+		// ԍėp
+		pool.release(child);
+		ASSERT_EQ(child, pool.create(root, 6));
+		ASSERT_FALSE(pool.node(child).hasPatch());
+
+		// y[W܂Ŋmۂ
+		CompactNodePool<int>::index_type last = 0;
+		forange(i, 20000) {
+			last = pool.create(root, 7);
+		}
+		ASSERT_LT(16384, last);
+		ASSERT_EQ(7, pool.argument(last));
+		ASSERT_EQ(root, pool.node(last).parent);
+	}
+}
@@ -0,0 +1,71 @@
+#include "pch.h"
+#include "../pch.h"
+
+#include "../../CppLib/SearcComponent/SearchConfig.hpp"
+#include "../../CppLib/SearcComponent/TimeSchedule.hpp"
+
+namespace SearcComponent::TimeScheduleTest {
+
+	/**
+	 * @brief ϓȎԔz̋@\eXg
+	*/
+	TEST(SearcComponent_TimeSchedule, EvenTimeSchedule_FuncTest01) {
+		using namespace alib::Search;
+
+		using Config = ConfigTemplate<10, 100, 1000, DefaultSearchMethod<int>>;
+		testing::StaticAssertTypeEq<Lib::EvenTimeSchedule, Config::TimeSchedule>();
+
+		Lib::EvenTimeSchedule schedule;
+		schedule.reset(1000, 0);
+		const auto first = schedule.next(0, 10, 100, 100);
+		ASSERT_DOUBLE_EQ(100, first.deadline);
+		ASSERT_EQ(100, first.width);
+
+		schedule.record(100, 40);
+		const auto second = schedule.next(40, 9, 100, 100);
+		ASSERT_DOUBLE_EQ(40 + 960.0 / 9, second.deadline);
+		ASSERT_EQ(100, second.width);
+	}
+
+	/**
+	 * @brief тɂ鎞Ԕz̋@\eXg
+	*/
+	TEST(SearcComponent_TimeSchedule, AdaptiveTimeSchedule_FuncTest01) {
+		using namespace alib::Search;
+
+		Lib::AdaptiveTimeSchedule<> schedule;
+		schedule.reset(1000, 0);
+
+		// тꍇ͊̓WJ
+		const auto first = schedule.next(0, 10, 100, 100000);
+		ASSERT_DOUBLE_EQ(100, first.deadline);
+		ASSERT_EQ(100, first.width);
+
+		// 1m[h0.1ms̏ꍇ͗\Z90%Ɏ܂WJi͊4{j
+		schedule.record(100, 10);
+		const auto wide = schedule.next(10, 9, 100, 100000);
+		ASSERT_DOUBLE_EQ(120, wide.deadline);
+		ASSERT_EQ(400, wide.width);
+
+		// 1m[h10ms̏ꍇ
+		schedule.record(100, 10 + 1000);
+		const auto narrow = schedule.next(1010, 9, 100, 100000);
+		ASSERT_EQ(1, narrow.width);
+	}
+
+	/**
+	 * @brief WJ̏̋@\eXg
+	*/
+	TEST(SearcComponent_TimeSchedule, AdaptiveTimeSchedule_FuncTest02) {
+		using namespace alib::Search;
+
+		Lib::AdaptiveTimeSchedule<> schedule;
+		// ␔͊̓WJ𒴂Ȃ
+		schedule.reset(1000, 0);
+		schedule.record(100, 1);
+		ASSERT_EQ(100, schedule.next(1, 9, 100, 100).width);
+
+		// [xƂ̓WJɍ킹ďς
+		ASSERT_EQ(40, schedule.next(1, 9, 10, 100000).width);
+	}
+}
@@ -0,0 +1,33 @@
+#include "pch.h"
+#include "../pch.h"
+
+#include "../../CppLib/SearcComponent/Timer.hpp"
+
+namespace SearcComponent::TimerTest {
+
+	/**
+	 * @brief ߐ؂̔̋@\eXg
+	*/
+	TEST(SearcComponent_Timer, DeadlineTimer_FuncTest01) {
+		using namespace alib::Search::Lib;
+
+		// e덷0̏ꍇ͖ǂݏo
+		DeadlineTimer exact;
+		exact.start();
+		ASSERT_TRUE(exact.reached(0));
+		ASSERT_FALSE(exact.reached(1000 * 1000));
+		ASSERT_TRUE(exact.reached(0));
+
+		DeadlineTimer timer(1.0);
+		timer.start();
+		size_t calls = 0;
+		while (not timer.reached(20)) {
+			calls++;
+		}
+		const auto elapsed = timer.interval();
+		ASSERT_LE(20, elapsed);
+		// e덷ɗ]TĔ肷
+		ASSERT_GT(20 + 1.0 + 50, elapsed);
+		ASSERT_LT(0, calls);
+	}
+}
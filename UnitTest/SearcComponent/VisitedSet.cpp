@@ -0,0 +1,90 @@
+#include "pch.h"
+#include "../pch.h"
+
+#include "../../CppLib/SearcComponent/VisitedSet.hpp"
+
+namespace SearcComponent::VisitedSetTest {
+
+	/**
+	 * @brief P@\eXg
+	*/
+	TEST(SearcComponent_VisitedSet, VisitedSet_FuncTest01) {
+		using namespace alib::Search::Lib;
+
+		VisitedSet visited(100);
+		const auto capacity = visited.capacity();
+		ASSERT_LE(100, capacity);
+		ASSERT_TRUE(visited.empty());
+
+		ASSERT_TRUE(visited.insert(10));
+		ASSERT_TRUE(visited.insert(20));
+		ASSERT_FALSE(visited.insert(10));
+		ASSERT_EQ(2, visited.size());
+
+		ASSERT_TRUE(visited.contains(10));
+		ASSERT_TRUE(visited.contains(20));
+		ASSERT_FALSE(visited.contains(30));
+
+		visited.clear();
+		ASSERT_TRUE(visited.empty());
+		ASSERT_FALSE(visited.contains(10));
+		ASSERT_TRUE(visited.insert(10));
+		ASSERT_EQ(capacity, visited.capacity());
+	}
+
+	/**
+	 * @brief g̋@\eXg
+	*/
+	TEST(SearcComponent_VisitedSet, VisitedSet_FuncTest02) {
+		using namespace alib::Search::Lib;
+
+		// e0̏ꍇ͓o^܂ŊmۂȂ
+		VisitedSet visited(0);
+		ASSERT_EQ(0, visited.capacity());
+		// ʃrbg̑nbVl
+		forange(i, 1000) {
+			ASSERT_TRUE(visited.insert(i << 16));
+		}
+		visited.clear();
+		forange(i, 1000) {
+			ASSERT_TRUE(visited.insert(i << 16));
+		}
+		ASSERT_EQ(1000, visited.size());
+		ASSERT_LE(1000, visited.capacity());
+
+		forange(i, 1000) {
+			ASSERT_TRUE(visited.contains(i << 16));
+			ASSERT_FALSE(visited.insert(i << 16));
+		}
+		ASSERT_FALSE(visited.contains(1));
+	}
+
+	/**
+	 * @brief l\̋@\eXg
+	*/
+	TEST(SearcComponent_VisitedSet, VisitedMap_FuncTest01) {
+		using namespace alib::Search::Lib;
+
+		VisitedMap<int> map;
+		forange(i, 100) {
+			const auto [value, inserted] = map.try_emplace(i * 7);
+			ASSERT_TRUE(inserted);
+			ASSERT_EQ(0, *value);
+			*value = alib::narrow_cast<int>(i);
+		}
+
+		const auto [value, inserted] = map.try_emplace(7);
+		ASSERT_FALSE(inserted);
+		ASSERT_EQ(1, *value);
+
+		forange(i, 100) {
+			ASSERT_NE(nullptr, map.find(i * 7));
+			ASSERT_EQ(alib::narrow_cast<int>(i), *map.find(i * 7));
+		}
+		ASSERT_EQ(nullptr, map.find(8));
+
+		map.clear();
+		ASSERT_EQ(nullptr, map.find(7));
+		ASSERT_EQ(0, *map.try_emplace(7).first);
+	}
+}
@@ -0,0 +1,65 @@
+#include "pch.h"
+#include "../pch.h"
+
+#include <atomic>
+#include <vector>
+#include <thread>
+
+#include "../../CppLib/SearcComponent/WorkerPool.hpp"
+
+namespace SearcComponent::WorkerPoolTest {
+
+	/**
+	 * @brief P@\eXg
+	*/
+	TEST(SearcComponent_WorkerPool, WorkerPool_FuncTest01) {
+		using namespace alib::Search::Lib;
+
+		constexpr size_t Workers = 3;
+		constexpr size_t Rounds = 100;
+
+		std::vector<int> counts(Workers);
+		std::vector<std::thread::id> ids(Workers);
+		std::atomic<int> changed = 0;
+		int round = 0;
+
+		WorkerPool pool;
+		pool.start(Workers, [&](const size_t idx) {
+			// e[J[͓XbhŌJԂ
+			const auto id = std::this_thread::get_id();
+			if (counts[idx] != 0 && ids[idx] != id) {
+				changed++;
+			}
+			ids[idx] = id;
+			// JnǑĂяo̕ύX
+			EXPECT_EQ(round, counts[idx]);
+			counts[idx]++;
+		});
+		ASSERT_EQ(Workers, pool.size());
+
+		forange(loop, Rounds) {
+			pool.dispatch();
+			pool.wait();
+			round++;
+			for (const auto count : counts) {
+				ASSERT_EQ(round, count);
+			}
+		}
+		pool.stop();
+		ASSERT_EQ(0, pool.size());
+		ASSERT_EQ(0, changed.load());
+	}
+
+	/**
+	 * @brief [J[0̋@\eXg
+	*/
+	TEST(SearcComponent_WorkerPool, WorkerPool_FuncTest02) {
+		using namespace alib::Search::Lib;
+
+		WorkerPool pool;
+		pool.start(0, [](const size_t) { FAIL(); });
+		pool.dispatch();
+		pool.wait();
+	}
+
+}